@@ -42,6 +42,7 @@ typedef uint8_t (*dmg_output_f)(uint8_t value);
 const char *dmg_error(dmg_t const dmg);
 dmg_error_e dmg_initialize(dmg_t *dmg, const dmg_data_t *const data, const dmg_output_f output);
 dmg_error_e dmg_input(dmg_t const dmg, uint8_t input, uint8_t *output);
+dmg_error_e dmg_jit(dmg_t const dmg);
 dmg_error_e dmg_load(dmg_t const dmg, const dmg_data_t *const data);
 dmg_error_e dmg_run(dmg_t const dmg);
 dmg_error_e dmg_save(dmg_t const dmg, dmg_data_t *const data);
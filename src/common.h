@@ -15,6 +15,14 @@
 #include <SDL.h>
 #include <dmg.h>
 
+#if !defined(DMG_SCALAR) && defined(__aarch64__)
+#define DMG_NEON
+#include <arm_neon.h>
+#elif !defined(DMG_SCALAR) && defined(__x86_64__)
+#define DMG_SSE
+#include <tmmintrin.h>
+#endif /* DMG_NEON */
+
 #define DMG_MAJOR 0
 #define DMG_MINOR 1
 #define DMG_PATCH 0xd963d00
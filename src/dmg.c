@@ -23,6 +23,15 @@ dmg_error_e dmg_input(dmg_t const dmg, uint8_t input, uint8_t *output)
     return dmg_system_input(dmg, input, output);
 }
 
+dmg_error_e dmg_jit(dmg_t const dmg)
+{
+    if (!dmg)
+    {
+        return DMG_FAILURE;
+    }
+    return dmg_system_jit(dmg);
+}
+
 dmg_error_e dmg_load(dmg_t const dmg, const dmg_data_t *const data)
 {
     if (!dmg)
@@ -31,6 +31,66 @@ static const SDL_Scancode SCANCODE[] =
     SDL_SCANCODE_D, SDL_SCANCODE_A, SDL_SCANCODE_W, SDL_SCANCODE_S,
 };
 
+static uint8_t dmg_system_default_read(dmg_t const dmg, uint16_t address)
+{
+    return 0xFF;
+}
+
+static void dmg_system_default_write(dmg_t const dmg, uint16_t address, uint8_t value)
+{
+}
+
+static bool dmg_system_event_before(dmg_t const dmg, uint8_t first, uint8_t second)
+{
+    bool result;
+    dmg_event_e event[] = { dmg->scheduler.event[first], dmg->scheduler.event[second] };
+    if (dmg->scheduler.timestamp[event[0]] == dmg->scheduler.timestamp[event[1]])
+    { /* EVENTS IN THE SAME CYCLE ARE ORDERED BY TYPE */
+        result = (event[0] < event[1]);
+    }
+    else
+    {
+        result = (dmg->scheduler.timestamp[event[0]] < dmg->scheduler.timestamp[event[1]]);
+    }
+    return result;
+}
+
+static void dmg_system_event_swap(dmg_t const dmg, uint8_t first, uint8_t second)
+{
+    uint8_t event = dmg->scheduler.event[first];
+    dmg->scheduler.event[first] = dmg->scheduler.event[second];
+    dmg->scheduler.event[second] = event;
+    dmg->scheduler.position[dmg->scheduler.event[first]] = first;
+    dmg->scheduler.position[dmg->scheduler.event[second]] = second;
+}
+
+static void dmg_system_event_sift(dmg_t const dmg, uint8_t index)
+{
+    while (index && dmg_system_event_before(dmg, index, (index - 1) / 2))
+    {
+        dmg_system_event_swap(dmg, index, (index - 1) / 2);
+        index = (index - 1) / 2;
+    }
+    for (;;)
+    {
+        uint8_t child = (2 * index) + 1, next = index;
+        if ((child < dmg->scheduler.count) && dmg_system_event_before(dmg, child, next))
+        {
+            next = child;
+        }
+        if ((++child < dmg->scheduler.count) && dmg_system_event_before(dmg, child, next))
+        {
+            next = child;
+        }
+        if (next == index)
+        {
+            break;
+        }
+        dmg_system_event_swap(dmg, index, next);
+        index = next;
+    }
+}
+
 static dmg_error_e dmg_system_initialize_audio(dmg_t const dmg)
 {
     SDL_AudioSpec desired =
@@ -46,8 +106,143 @@ static dmg_error_e dmg_system_initialize_audio(dmg_t const dmg)
     return DMG_SUCCESS;
 }
 
+static void dmg_system_initialize_io(dmg_t const dmg)
+{
+    for (uint32_t address = 0xFF00; address <= 0xFFFF; ++address)
+    {
+        uint8_t (*read)(dmg_t const dmg, uint16_t address) = dmg_system_default_read;
+        void (*write)(dmg_t const dmg, uint16_t address, uint8_t value) = dmg_system_default_write;
+        switch (address)
+        {
+            case 0xFF00: /* CONTROLLER */
+                read = dmg_controller_read;
+                write = dmg_controller_write;
+                break;
+            case 0xFF01 ... 0xFF02: /* SERIAL */
+                read = dmg_serial_read;
+                write = dmg_serial_write;
+                break;
+            case 0xFF04 ... 0xFF07: /* TIMER */
+                read = dmg_timer_read;
+                write = dmg_timer_write;
+                break;
+            case 0xFF0F: /* PROCESSOR */
+            case 0xFFFF:
+                read = dmg_processor_read;
+                write = dmg_processor_write;
+                break;
+            case 0xFF10 ... 0xFF14: /* AUDIO */
+            case 0xFF16 ... 0xFF19:
+            case 0xFF1A ... 0xFF1E:
+            case 0xFF20 ... 0xFF26:
+            case 0xFF30 ... 0xFF3F:
+                read = dmg_audio_read;
+                write = dmg_audio_write;
+                break;
+            case 0xFF40 ... 0xFF4B: /* VIDEO */
+                read = dmg_video_read;
+                write = dmg_video_write;
+                break;
+            case 0xFF50: /* BOOTLOADER */
+                write = dmg_memory_write;
+                break;
+            case 0xFF80 ... 0xFFFE: /* HIGH RAM */
+                read = dmg_memory_read;
+                write = dmg_memory_write;
+                break;
+            default: /* UNUSED */
+                break;
+        }
+        dmg->io.read[address & 0xFF] = read;
+        dmg->io.write[address & 0xFF] = write;
+    }
+}
+
+static void dmg_system_initialize_scheduler(dmg_t const dmg)
+{
+    for (dmg_event_e event = 0; event < DMG_EVENT_MAX; ++event)
+    {
+        dmg->scheduler.position[event] = DMG_EVENT_MAX;
+        dmg->scheduler.timestamp[event] = UINT64_MAX;
+    }
+    dmg_system_schedule(dmg, DMG_EVENT_AUDIO, 0);
+    dmg_system_schedule(dmg, DMG_EVENT_TIMER, 0);
+    dmg_system_schedule(dmg, DMG_EVENT_VIDEO, 0);
+    dmg_audio_advance(dmg, 0);
+    dmg_serial_advance(dmg, 0);
+    dmg_timer_advance(dmg, 0);
+}
+
+static dmg_error_e dmg_system_resize(dmg_t const dmg)
+{
+    int height, width;
+    uint8_t scale;
+    if (SDL_GetRendererOutputSize(dmg->service.renderer, &width, &height))
+    {
+        return DMG_ERROR(dmg, "SDL_GetRendererOutputSize failed -- %s", SDL_GetError());
+    }
+    if ((height /= 144) < (width /= 160))
+    {
+        width = height;
+    }
+    scale = (width < 1) ? 1 : (width > 16) ? 16 : width;
+    if (scale != dmg->service.scale)
+    { /* TEXTURE MATCHES THE LARGEST INTEGER SCALE THAT FITS THE WINDOW */
+        if (dmg->service.texture)
+        {
+            SDL_DestroyTexture(dmg->service.texture);
+            dmg->service.texture = NULL;
+        }
+        free(dmg->service.pixel);
+        dmg->service.pitch = (160 * scale) + 4;
+        if (!(dmg->service.pixel = calloc(dmg->service.pitch * 144 * scale, sizeof (uint32_t))))
+        {
+            return DMG_ERROR(dmg, "Failed to allocate pixels -- %ux", (unsigned)scale);
+        }
+        if (!(dmg->service.texture = SDL_CreateTexture(dmg->service.renderer, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_STREAMING, 160 * scale, 144 * scale)))
+        {
+            return DMG_ERROR(dmg, "SDL_CreateTexture failed -- %s", SDL_GetError());
+        }
+        if (SDL_RenderSetLogicalSize(dmg->service.renderer, 160 * scale, 144 * scale))
+        {
+            return DMG_ERROR(dmg, "SDL_RenderSetLogicalSize failed -- %s", SDL_GetError());
+        }
+        dmg->service.scaler = (scale >= 3) ? DMG_SCALER_GRID : (scale == 2) ? DMG_SCALER_SCALE2X : DMG_SCALER_NEAREST;
+        dmg->service.scale = scale;
+    }
+    return DMG_SUCCESS;
+}
+
+static void dmg_system_initialize_shade(dmg_t const dmg)
+{
+    for (uint8_t shadow = 0; shadow < 2; ++shadow)
+    {
+        for (uint8_t grid = 0; grid < 2; ++grid)
+        {
+            for (dmg_color_e color = DMG_COLOR_WHITE; color < DMG_COLOR_MAX; ++color)
+            {
+                dmg_pixel_t value = PALETTE[color];
+                if (grid)
+                {
+                    value.red *= 0.95;
+                    value.green *= 0.95;
+                    value.blue *= 0.95;
+                }
+                if (shadow)
+                {
+                    value.red *= 0.75;
+                    value.green *= 0.75;
+                    value.blue *= 0.75;
+                }
+                dmg->service.shade[shadow][grid][color] = value.raw;
+            }
+        }
+    }
+}
+
 static dmg_error_e dmg_system_initialize_video(dmg_t const dmg)
 {
+    dmg_system_initialize_shade(dmg);
     if (!(dmg->service.window = SDL_CreateWindow(dmg_cartridge_title(dmg), SDL_WINDOWPOS_CENTERED, SDL_WINDOWPOS_CENTERED, 480, 432, SDL_WINDOW_RESIZABLE)))
     {
         return DMG_ERROR(dmg, "SDL_CreateWindow failed -- %s", SDL_GetError());
@@ -56,9 +251,9 @@ static dmg_error_e dmg_system_initialize_video(dmg_t const dmg)
     {
         return DMG_ERROR(dmg, "SDL_CreateRenderer failed -- %s", SDL_GetError());
     }
-    if (SDL_RenderSetLogicalSize(dmg->service.renderer, 480, 432))
+    if (SDL_RenderSetIntegerScale(dmg->service.renderer, SDL_TRUE))
     {
-        return DMG_ERROR(dmg, "SDL_RenderSetLogicalSize failed -- %s", SDL_GetError());
+        return DMG_ERROR(dmg, "SDL_RenderSetIntegerScale failed -- %s", SDL_GetError());
     }
     if (SDL_SetRenderDrawColor(dmg->service.renderer, 0, 0, 0, 0))
     {
@@ -72,16 +267,31 @@ static dmg_error_e dmg_system_initialize_video(dmg_t const dmg)
     {
         return DMG_ERROR(dmg, "SDL_SetHint failed -- %s", SDL_GetError());
     }
-    if (!(dmg->service.texture = SDL_CreateTexture(dmg->service.renderer, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_STREAMING, 480, 432)))
-    {
-        return DMG_ERROR(dmg, "SDL_CreateTexture failed -- %s", SDL_GetError());
-    }
     if (!(dmg->service.cursor = SDL_CreateSystemCursor(SDL_SYSTEM_CURSOR_CROSSHAIR)))
     {
         return DMG_ERROR(dmg, "SDL_CreateSystemCursor failed -- %s", SDL_GetError());
     }
     SDL_SetCursor(dmg->service.cursor);
-    return DMG_SUCCESS;
+    return dmg_system_resize(dmg);
+}
+
+static bool dmg_system_step(dmg_t const dmg)
+{
+    bool result = false;
+#ifdef DMG_THREADED
+    uint8_t cycles = dmg_processor_run(dmg);
+#else
+    uint8_t cycles = dmg_processor_step(dmg);
+#endif /* DMG_THREADED */
+    if (dmg->scheduler.timestamp[dmg->scheduler.event[0]] <= (dmg->scheduler.cycle + cycles))
+    {
+        dmg_timer_advance(dmg, cycles); /* FRAME SEQUENCER TICKS BEFORE AUDIO CATCHES UP */
+        dmg_audio_advance(dmg, cycles);
+        dmg_serial_advance(dmg, cycles);
+        result = dmg_video_advance(dmg, cycles);
+    }
+    dmg->scheduler.cycle += cycles;
+    return result;
 }
 
 static void dmg_system_uninitialize_audio(dmg_t const dmg)
@@ -111,44 +321,160 @@ static void dmg_system_uninitialize_video(dmg_t const dmg)
     {
         SDL_DestroyWindow(dmg->service.window);
     }
+    free(dmg->service.pixel);
+    dmg->service.pixel = NULL;
+}
+
+static void dmg_system_fill(uint32_t *pixel, uint32_t value, uint8_t count)
+{ /* ROWS ARE PADDED, SO STORES MAY RUN UP TO 3 PIXELS PAST THE COUNT */
+#if defined(DMG_NEON)
+    uint32x4_t fill = vdupq_n_u32(value);
+    for (uint8_t index = 0; index < count; index += 4)
+    {
+        vst1q_u32(pixel + index, fill);
+    }
+#elif defined(DMG_SSE)
+    __m128i fill = _mm_set1_epi32(value);
+    for (uint8_t index = 0; index < count; index += 4)
+    {
+        _mm_storeu_si128((__m128i *)(pixel + index), fill);
+    }
+#else
+    for (uint8_t index = 0; index < count; ++index)
+    {
+        pixel[index] = value;
+    }
+#endif /* DMG_NEON */
 }
 
-static void dmg_system_update(dmg_t const dmg)
+static uint32_t *dmg_system_pixel(dmg_t const dmg, uint16_t y)
 {
-    for (uint8_t y = 0; y < 144; ++y)
+    return &dmg->service.pixel[y * dmg->service.pitch];
+}
+
+static void dmg_system_scale_grid(dmg_t const dmg, uint8_t y)
+{ /* EACH PIXEL EXPANDS TO A BLOCK, WITH GRID LINES ALONG THE TOP AND LEFT */
+    uint8_t scale = dmg->service.scale;
+    const uint8_t *row = dmg_video_color(dmg, y), *row_above = y ? dmg_video_color(dmg, y - 1) : row;
+    uint32_t *line[] = { dmg_system_pixel(dmg, y * scale), dmg_system_pixel(dmg, (y * scale) + 1) };
+    for (uint8_t x = 0; x < 160; ++x)
+    {
+        const uint32_t (*shade)[4] = dmg->service.shade[row_above[x] > row[x]];
+        dmg_system_fill(&line[0][x * scale], shade[1][row[x]], scale);
+        dmg_system_fill(&line[1][x * scale], shade[0][row[x]], scale);
+        line[1][x * scale] = shade[1][row[x]];
+    }
+    for (uint8_t offset = 2; offset < scale; ++offset)
     {
+        memcpy(dmg_system_pixel(dmg, (y * scale) + offset), line[1], 160 * scale * sizeof (uint32_t));
+    }
+}
+
+static void dmg_system_scale_nearest(dmg_t const dmg, uint8_t y)
+{
+    uint8_t scale = dmg->service.scale;
+    const uint8_t *row = dmg_video_color(dmg, y);
+    uint32_t *line = dmg_system_pixel(dmg, y * scale);
+    for (uint8_t x = 0; x < 160; ++x)
+    {
+        dmg_system_fill(&line[x * scale], dmg->service.shade[0][0][row[x]], scale);
+    }
+    for (uint8_t offset = 1; offset < scale; ++offset)
+    {
+        memcpy(dmg_system_pixel(dmg, (y * scale) + offset), line, 160 * scale * sizeof (uint32_t));
+    }
+}
+
+static void dmg_system_scale_scale2x(dmg_t const dmg, uint8_t y)
+{
+    uint32_t *line[] = { dmg_system_pixel(dmg, y * 2), dmg_system_pixel(dmg, (y * 2) + 1) };
+    for (uint8_t index = 0; index < 3; ++index)
+    { /* SHADE THE LINES ABOVE, AT AND BELOW, WITH EDGES REPEATED */
+        const uint8_t *row = dmg_video_color(dmg, (!index && y) ? (y - 1) : ((index == 2) && (y < 143)) ? (y + 1) : y);
         for (uint8_t x = 0; x < 160; ++x)
         {
-            uint16_t x_base = x * 3, y_base = y * 3;
-            dmg_color_e color = dmg_video_color(dmg, x, y), color_above = color;
-            if (y)
-            {
-                color_above = dmg_video_color(dmg, x, y - 1);
-            }
-            for (uint8_t y_off = 0; y_off < 3; ++y_off)
-            {
-                for (uint8_t x_off = 0; x_off < 3; ++x_off)
-                {
-                    dmg_pixel_t value = PALETTE[color];
-                    if (!x_off || !y_off)
-                    {
-                        value.red *= 0.95;
-                        value.green *= 0.95;
-                        value.blue *= 0.95;
-                    }
-                    if (color_above > color)
-                    {
-                        value.red *= 0.75;
-                        value.green *= 0.75;
-                        value.blue *= 0.75;
-                    }
-                    dmg->service.pixel[y_base + y_off][x_base + x_off] = value.raw;
-                }
-            }
+            dmg->service.line[index][x + 1] = dmg->service.shade[0][0][row[x]];
+        }
+        dmg->service.line[index][0] = dmg->service.line[index][1];
+        dmg->service.line[index][161] = dmg->service.line[index][160];
+    }
+    for (uint8_t x = 0; x < 160; x += 4)
+    { /* A=ABOVE, B=RIGHT, C=LEFT, D=BELOW */
+#if defined(DMG_NEON)
+        uint32x4_t a = vld1q_u32(&dmg->service.line[0][x + 1]), b = vld1q_u32(&dmg->service.line[1][x + 2]), c = vld1q_u32(&dmg->service.line[1][x]),
+            d = vld1q_u32(&dmg->service.line[2][x + 1]), p = vld1q_u32(&dmg->service.line[1][x + 1]);
+        uint32x4_t ab = vceqq_u32(a, b), ac = vceqq_u32(a, c), bd = vceqq_u32(b, d), cd = vceqq_u32(c, d);
+        uint32x4x2_t value;
+        value.val[0] = vbslq_u32(vbicq_u32(vbicq_u32(ac, cd), ab), a, p);
+        value.val[1] = vbslq_u32(vbicq_u32(vbicq_u32(ab, ac), bd), b, p);
+        vst2q_u32(&line[0][x * 2], value);
+        value.val[0] = vbslq_u32(vbicq_u32(vbicq_u32(cd, bd), ac), c, p);
+        value.val[1] = vbslq_u32(vbicq_u32(vbicq_u32(bd, ab), cd), d, p);
+        vst2q_u32(&line[1][x * 2], value);
+#elif defined(DMG_SSE)
+        __m128i a = _mm_loadu_si128((const __m128i *)&dmg->service.line[0][x + 1]), b = _mm_loadu_si128((const __m128i *)&dmg->service.line[1][x + 2]),
+            c = _mm_loadu_si128((const __m128i *)&dmg->service.line[1][x]), d = _mm_loadu_si128((const __m128i *)&dmg->service.line[2][x + 1]),
+            p = _mm_loadu_si128((const __m128i *)&dmg->service.line[1][x + 1]);
+        __m128i ab = _mm_cmpeq_epi32(a, b), ac = _mm_cmpeq_epi32(a, c), bd = _mm_cmpeq_epi32(b, d), cd = _mm_cmpeq_epi32(c, d);
+        __m128i mask[] = { _mm_andnot_si128(ab, _mm_andnot_si128(cd, ac)), _mm_andnot_si128(bd, _mm_andnot_si128(ac, ab)),
+            _mm_andnot_si128(ac, _mm_andnot_si128(bd, cd)), _mm_andnot_si128(cd, _mm_andnot_si128(ab, bd)) };
+        __m128i value[] = { _mm_or_si128(_mm_and_si128(mask[0], a), _mm_andnot_si128(mask[0], p)), _mm_or_si128(_mm_and_si128(mask[1], b), _mm_andnot_si128(mask[1], p)),
+            _mm_or_si128(_mm_and_si128(mask[2], c), _mm_andnot_si128(mask[2], p)), _mm_or_si128(_mm_and_si128(mask[3], d), _mm_andnot_si128(mask[3], p)) };
+        _mm_storeu_si128((__m128i *)&line[0][x * 2], _mm_unpacklo_epi32(value[0], value[1]));
+        _mm_storeu_si128((__m128i *)&line[0][(x * 2) + 4], _mm_unpackhi_epi32(value[0], value[1]));
+        _mm_storeu_si128((__m128i *)&line[1][x * 2], _mm_unpacklo_epi32(value[2], value[3]));
+        _mm_storeu_si128((__m128i *)&line[1][(x * 2) + 4], _mm_unpackhi_epi32(value[2], value[3]));
+#else
+        for (uint8_t index = x + 1; index < (x + 5); ++index)
+        {
+            uint32_t a = dmg->service.line[0][index], b = dmg->service.line[1][index + 1], c = dmg->service.line[1][index - 1],
+                d = dmg->service.line[2][index], p = dmg->service.line[1][index];
+            line[0][(index - 1) * 2] = ((a == c) && (c != d) && (a != b)) ? a : p;
+            line[0][((index - 1) * 2) + 1] = ((a == b) && (a != c) && (b != d)) ? b : p;
+            line[1][(index - 1) * 2] = ((c == d) && (d != b) && (c != a)) ? c : p;
+            line[1][((index - 1) * 2) + 1] = ((b == d) && (b != a) && (d != c)) ? d : p;
+        }
+#endif /* DMG_NEON */
+    }
+}
+
+static void dmg_system_update(dmg_t const dmg, uint8_t first, uint8_t last)
+{
+    for (uint8_t y = first; y <= last; ++y)
+    {
+        switch (dmg->service.scaler)
+        {
+            case DMG_SCALER_GRID:
+                dmg_system_scale_grid(dmg, y);
+                break;
+            case DMG_SCALER_SCALE2X:
+                dmg_system_scale_scale2x(dmg, y);
+                break;
+            default:
+                dmg_system_scale_nearest(dmg, y);
+                break;
         }
     }
 }
 
+uint64_t dmg_system_cycle(dmg_t const dmg)
+{
+    return dmg->scheduler.cycle;
+}
+
+uint64_t dmg_system_deadline(dmg_t const dmg)
+{
+    uint64_t result = dmg->scheduler.timestamp[DMG_EVENT_SERIAL];
+    for (dmg_event_e event = DMG_EVENT_TIMER; event < DMG_EVENT_MAX; ++event)
+    { /* AUDIO EVENTS NEVER CHANGE PROCESSOR-VISIBLE STATE */
+        if (dmg->scheduler.timestamp[event] < result)
+        {
+            result = dmg->scheduler.timestamp[event];
+        }
+    }
+    return result;
+}
+
 dmg_error_e dmg_system_input(dmg_t const dmg, uint8_t input, uint8_t *output)
 {
     if (!dmg->initialized)
@@ -170,6 +496,7 @@ dmg_error_e dmg_system_initialize(dmg_t dmg, const dmg_data_t *const data, const
     {
         return DMG_ERROR(dmg, "System reinitialized");
     }
+    dmg_system_initialize_io(dmg);
     if ((result = dmg_memory_initialize(dmg, data)) != DMG_SUCCESS)
     {
         return result;
@@ -178,6 +505,12 @@ dmg_error_e dmg_system_initialize(dmg_t dmg, const dmg_data_t *const data, const
     {
         return result;
     }
+    if ((result = dmg_processor_initialize(dmg)) != DMG_SUCCESS)
+    {
+        return result;
+    }
+    dmg_video_initialize(dmg);
+    dmg_system_initialize_scheduler(dmg);
     if (SDL_Init(SDL_INIT_AUDIO | SDL_INIT_VIDEO))
     {
         return DMG_ERROR(dmg, "SDL_Init failed -- %s", SDL_GetError());
@@ -195,6 +528,15 @@ dmg_error_e dmg_system_initialize(dmg_t dmg, const dmg_data_t *const data, const
     return result;
 }
 
+dmg_error_e dmg_system_jit(dmg_t const dmg)
+{
+    if (!dmg->initialized)
+    {
+        return DMG_ERROR(dmg, "System uninitialized");
+    }
+    return dmg_processor_jit(dmg);
+}
+
 dmg_error_e dmg_system_load(dmg_t const dmg, const dmg_data_t *const data)
 {
     if (!dmg->initialized)
@@ -237,36 +579,47 @@ bool dmg_system_poll(dmg_t const dmg)
 uint8_t dmg_system_read(dmg_t const dmg, uint16_t address)
 {
     uint8_t result = 0xFF;
-    switch (address)
+    const uint8_t *page = dmg->memory.page.read[address >> 8];
+    if (page)
+    { /* ROM/RAM */
+        result = page[address & 0xFF];
+    }
+    else if (address >= 0xFF00)
+    { /* I/O */
+        result = dmg->io.read[address & 0xFF](dmg, address);
+    }
+    else
     {
-        case 0x8000 ... 0x9FFF: /* VIDEO */
-        case 0xFE00 ... 0xFE9F:
-        case 0xFF40 ... 0xFF4B:
-            result = dmg_video_read(dmg, address);
-            break;
-        case 0xFF00: /* CONTROLLER */
-            result = dmg_controller_read(dmg, address);
-            break;
-        case 0xFF01 ... 0xFF02: /* SERIAL */
-            result = dmg_serial_read(dmg, address);
-            break;
-        case 0xFF04 ... 0xFF07: /* TIMER */
-            result = dmg_timer_read(dmg, address);
-            break;
-        case 0xFF0F: /* PROCESSOR */
-        case 0xFFFF:
-            result = dmg_processor_read(dmg, address);
-            break;
-        case 0xFF10 ... 0xFF14: /* AUDIO */
-        case 0xFF16 ... 0xFF19:
-        case 0xFF1A ... 0xFF1E:
-        case 0xFF20 ... 0xFF26:
-        case 0xFF30 ... 0xFF3F:
-            result = dmg_audio_read(dmg, address);
-            break;
-        default: /* MEMORY */
-            result = dmg_memory_read(dmg, address);
-            break;
+        switch (address)
+        {
+            case 0x8000 ... 0x9FFF: /* VIDEO */
+            case 0xFE00 ... 0xFE9F:
+                result = dmg_video_read(dmg, address);
+                break;
+            default: /* MEMORY */
+                result = dmg_memory_read(dmg, address);
+                break;
+        }
+    }
+    return result;
+}
+
+uint16_t dmg_system_read_word(dmg_t const dmg, uint16_t address)
+{
+    uint16_t result;
+    const uint8_t *page = dmg->memory.page.read[address >> 8];
+    if (page && ((address & 0xFF) != 0xFF))
+    { /* ROM/RAM */
+        result = page[address & 0xFF] | (page[(address & 0xFF) + 1] << 8);
+    }
+    else if ((address >= 0xFF80) && (address < 0xFFFE))
+    { /* HIGH RAM */
+        result = dmg->memory.ram.high[address - 0xFF80] | (dmg->memory.ram.high[address - 0xFF7F] << 8);
+    }
+    else
+    {
+        result = dmg_system_read(dmg, address);
+        result |= dmg_system_read(dmg, address + 1) << 8;
     }
     return result;
 }
@@ -280,13 +633,7 @@ dmg_error_e dmg_system_run(dmg_t const dmg)
     while (dmg_system_poll(dmg))
     {
         dmg_error_e result;
-        do
-        {
-            dmg_audio_clock(dmg);
-            dmg_serial_clock(dmg);
-            dmg_timer_clock(dmg);
-            dmg_processor_clock(dmg);
-        } while (!dmg_video_clock(dmg));
+        while (!dmg_system_step(dmg));
         if ((result = dmg_system_sync(dmg)) != DMG_SUCCESS)
         {
             return result;
@@ -304,6 +651,19 @@ dmg_error_e dmg_system_save(dmg_t const dmg, dmg_data_t *const data)
     return dmg_cartridge_save(dmg, data);
 }
 
+void dmg_system_schedule(dmg_t const dmg, dmg_event_e event, uint64_t cycle)
+{
+    uint8_t index = dmg->scheduler.position[event];
+    if (index >= DMG_EVENT_MAX)
+    {
+        index = dmg->scheduler.count++;
+        dmg->scheduler.event[index] = event;
+        dmg->scheduler.position[event] = index;
+    }
+    dmg->scheduler.timestamp[event] = cycle;
+    dmg_system_event_sift(dmg, index);
+}
+
 uint8_t dmg_system_silence(dmg_t const dmg)
 {
     return dmg->service.audio.spec.silence;
@@ -311,11 +671,38 @@ uint8_t dmg_system_silence(dmg_t const dmg)
 
 dmg_error_e dmg_system_sync(dmg_t const dmg)
 {
+    dmg_error_e result;
     uint32_t elapsed;
-    dmg_system_update(dmg);
-    if (SDL_UpdateTexture(dmg->service.texture, NULL, dmg->service.pixel, 480 * sizeof (uint32_t)))
+    uint8_t first, last, scale = dmg->service.scale;
+    if ((result = dmg_system_resize(dmg)) != DMG_SUCCESS)
     {
-        return DMG_ERROR(dmg, "SDL_UpdateTexture failed -- %s", SDL_GetError());
+        return result;
+    }
+    if (dmg_video_dirty(dmg, &first, &last) || (scale != dmg->service.scale))
+    { /* ONLY CHANGED LINES, AND THE NEIGHBORING LINES SCALED FROM THEM, ARE EXPANDED AND UPLOADED */
+        SDL_Rect rect;
+        if (scale != dmg->service.scale)
+        {
+            first = 0;
+            last = 143;
+        }
+        if (first)
+        {
+            --first;
+        }
+        if (last < 143)
+        {
+            ++last;
+        }
+        rect.x = 0;
+        rect.y = first * dmg->service.scale;
+        rect.w = 160 * dmg->service.scale;
+        rect.h = (last - first + 1) * dmg->service.scale;
+        dmg_system_update(dmg, first, last);
+        if (SDL_UpdateTexture(dmg->service.texture, &rect, dmg_system_pixel(dmg, rect.y), dmg->service.pitch * sizeof (uint32_t)))
+        {
+            return DMG_ERROR(dmg, "SDL_UpdateTexture failed -- %s", SDL_GetError());
+        }
     }
     if (SDL_RenderClear(dmg->service.renderer))
     {
@@ -334,46 +721,79 @@ dmg_error_e dmg_system_sync(dmg_t const dmg)
     return DMG_SUCCESS;
 }
 
+uint64_t dmg_system_timestamp(dmg_t const dmg, dmg_event_e event)
+{
+    return dmg->scheduler.timestamp[event];
+}
+
 void dmg_system_uninitialize(dmg_t const dmg)
 {
     dmg->initialized = false;
     dmg_system_uninitialize_audio(dmg);
     dmg_system_uninitialize_video(dmg);
     SDL_Quit();
+    dmg_processor_uninitialize(dmg);
     dmg_cartridge_uninitialize(dmg);
 }
 
+void dmg_system_unschedule(dmg_t const dmg, dmg_event_e event)
+{
+    uint8_t index = dmg->scheduler.position[event];
+    if (index < DMG_EVENT_MAX)
+    {
+        dmg->scheduler.position[event] = DMG_EVENT_MAX;
+        dmg->scheduler.timestamp[event] = UINT64_MAX;
+        if (index != --dmg->scheduler.count)
+        {
+            dmg->scheduler.event[index] = dmg->scheduler.event[dmg->scheduler.count];
+            dmg->scheduler.position[dmg->scheduler.event[index]] = index;
+            dmg_system_event_sift(dmg, index);
+        }
+    }
+}
+
 void dmg_system_write(dmg_t const dmg, uint16_t address, uint8_t value)
 {
-    switch (address)
+    uint8_t *page = dmg->memory.page.write[address >> 8];
+    if (page)
+    { /* RAM */
+        page[address & 0xFF] = value;
+    }
+    else if (address >= 0xFF00)
+    { /* I/O */
+        dmg->io.write[address & 0xFF](dmg, address, value);
+    }
+    else
     {
-        case 0x8000 ... 0x9FFF: /* VIDEO */
-        case 0xFE00 ... 0xFE9F:
-        case 0xFF40 ... 0xFF4B:
-            dmg_video_write(dmg, address, value);
-            break;
-        case 0xFF00: /* CONTROLLER */
-            dmg_controller_write(dmg, address, value);
-            break;
-        case 0xFF01 ... 0xFF02: /* SERIAL */
-            dmg_serial_write(dmg, address, value);
-            break;
-        case 0xFF04 ... 0xFF07: /* TIMER */
-            dmg_timer_write(dmg, address, value);
-            break;
-        case 0xFF0F: /* PROCESSOR */
-        case 0xFFFF:
-            dmg_processor_write(dmg, address, value);
-            break;
-        case 0xFF10 ... 0xFF14: /* AUDIO */
-        case 0xFF16 ... 0xFF19:
-        case 0xFF1A ... 0xFF1E:
-        case 0xFF20 ... 0xFF26:
-        case 0xFF30 ... 0xFF3F:
-            dmg_audio_write(dmg, address, value);
-            break;
-        default: /* MEMORY */
-            dmg_memory_write(dmg, address, value);
-            break;
+        switch (address)
+        {
+            case 0x8000 ... 0x9FFF: /* VIDEO */
+            case 0xFE00 ... 0xFE9F:
+                dmg_video_write(dmg, address, value);
+                break;
+            default: /* MEMORY */
+                dmg_memory_write(dmg, address, value);
+                break;
+        }
+    }
+}
+
+void dmg_system_write_word(dmg_t const dmg, uint16_t address, uint16_t value)
+{
+    uint8_t *page = dmg->memory.page.write[address >> 8];
+    if (page && ((address & 0xFF) != 0xFF))
+    { /* RAM */
+        page[address & 0xFF] = value;
+        page[(address & 0xFF) + 1] = value >> 8;
+    }
+    else if ((address >= 0xFF80) && (address < 0xFFFE))
+    { /* HIGH RAM */
+        dmg->memory.ram.high[address - 0xFF80] = value;
+        dmg->memory.ram.high[address - 0xFF7F] = value >> 8;
+    }
+    else
+    { /* HIGH BYTE FIRST, AS PUSHED ONTO THE STACK */
+        dmg_system_write(dmg, address + 1, value >> 8);
+        dmg_system_write(dmg, address, value);
     }
 }
@@ -14,6 +14,22 @@
 #include <timer.h>
 #include <video.h>
 
+typedef enum
+{
+    DMG_EVENT_AUDIO = 0,
+    DMG_EVENT_SERIAL,
+    DMG_EVENT_TIMER,
+    DMG_EVENT_VIDEO,
+    DMG_EVENT_MAX,
+} dmg_event_e;
+
+typedef enum
+{
+    DMG_SCALER_NEAREST = 0,
+    DMG_SCALER_GRID,
+    DMG_SCALER_SCALE2X,
+} dmg_scaler_e;
+
 struct dmg_s
 {
     char error[256];
@@ -26,9 +42,27 @@ struct dmg_s
     dmg_timer_t timer;
     dmg_video_t video;
     struct
+    {
+        uint8_t (*read[0x100])(dmg_t const dmg, uint16_t address);
+        void (*write[0x100])(dmg_t const dmg, uint16_t address, uint8_t value);
+    } io;
+    struct
+    {
+        uint64_t cycle;
+        uint8_t count;
+        uint8_t event[DMG_EVENT_MAX];
+        uint8_t position[DMG_EVENT_MAX];
+        uint64_t timestamp[DMG_EVENT_MAX];
+    } scheduler;
+    struct
     {
         uint32_t tick;
-        uint32_t pixel[432][480];
+        uint32_t line[3][162];
+        uint32_t pitch;
+        uint32_t *pixel;
+        uint8_t scale;
+        dmg_scaler_e scaler;
+        uint32_t shade[2][2][4];
         SDL_Cursor *cursor;
         SDL_Renderer *renderer;
         SDL_Texture *texture;
@@ -41,16 +75,24 @@ struct dmg_s
     } service;
 };
 
+uint64_t dmg_system_cycle(dmg_t const dmg);
+uint64_t dmg_system_deadline(dmg_t const dmg);
 dmg_error_e dmg_system_initialize(dmg_t dmg, const dmg_data_t *const data, const dmg_output_f output);
 dmg_error_e dmg_system_input(dmg_t const dmg, uint8_t input, uint8_t *output);
+dmg_error_e dmg_system_jit(dmg_t const dmg);
 dmg_error_e dmg_system_load(dmg_t const dmg, const dmg_data_t *const data);
 bool dmg_system_poll(dmg_t const dmg);
 uint8_t dmg_system_read(dmg_t const dmg, uint16_t address);
+uint16_t dmg_system_read_word(dmg_t const dmg, uint16_t address);
 dmg_error_e dmg_system_run(dmg_t const dmg);
 uint8_t dmg_system_silence(dmg_t const dmg);
 dmg_error_e dmg_system_save(dmg_t const dmg, dmg_data_t *const data);
+void dmg_system_schedule(dmg_t const dmg, dmg_event_e event, uint64_t cycle);
 dmg_error_e dmg_system_sync(dmg_t const dmg);
+uint64_t dmg_system_timestamp(dmg_t const dmg, dmg_event_e event);
 void dmg_system_uninitialize(dmg_t const dmg);
+void dmg_system_unschedule(dmg_t const dmg, dmg_event_e event);
 void dmg_system_write(dmg_t const dmg, uint16_t address, uint8_t value);
+void dmg_system_write_word(dmg_t const dmg, uint16_t address, uint16_t value);
 
 #endif /* DMG_SYSTEM_H_ */
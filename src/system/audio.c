@@ -112,18 +112,27 @@ static float dmg_audio_sample_volume(dmg_t const dmg)
     return (dmg->audio.volume.right_volume + dmg->audio.volume.left_volume + 2.f) / 16.f;
 }
 
-void dmg_audio_clock(dmg_t const dmg)
+static void dmg_audio_sync(dmg_t const dmg, uint64_t cycle)
 {
-    if (!dmg->audio.delay)
+    while (dmg->audio.cycle <= cycle)
     {
         if (dmg->audio.control.enabled && dmg_audio_buffer_writable(dmg))
         {
             float sample = dmg_audio_sample_mixer(dmg) * dmg_audio_sample_volume(dmg);
             dmg_audio_buffer_write(dmg, sample * INT16_MAX);
         }
-        dmg->audio.delay = 96; /* 44.1KHz */
+        dmg->audio.cycle += 96; /* 44.1KHz */
+    }
+}
+
+void dmg_audio_advance(dmg_t const dmg, uint32_t cycles)
+{
+    uint64_t end = dmg_system_cycle(dmg) + cycles;
+    dmg_audio_sync(dmg, end);
+    if (dmg_system_timestamp(dmg, DMG_EVENT_AUDIO) <= end)
+    { /* SAMPLES ARE OTHERWISE CAUGHT UP ON REGISTER WRITES AND OTHER EVENTS */
+        dmg_system_schedule(dmg, DMG_EVENT_AUDIO, dmg->audio.cycle + (96 * 63));
     }
-    --dmg->audio.delay;
 }
 
 void dmg_audio_initialize(dmg_t const dmg)
@@ -133,6 +142,7 @@ void dmg_audio_initialize(dmg_t const dmg)
 
 void dmg_audio_interrupt(dmg_t const dmg)
 {
+    dmg_audio_sync(dmg, dmg_system_cycle(dmg));
     if (!(dmg->audio.counter % 2))
     {
         /* TODO: STEP SOUND LENGTH */
@@ -233,6 +243,7 @@ uint8_t dmg_audio_read(dmg_t const dmg, uint16_t address)
 
 void dmg_audio_write(dmg_t const dmg, uint16_t address, uint8_t value)
 {
+    dmg_audio_sync(dmg, dmg_system_cycle(dmg));
     switch (address)
     {
         case 0xFF10: /* NR10 */
@@ -158,9 +158,9 @@ typedef union
 typedef struct
 {
     uint8_t counter;
-    uint8_t delay;
     uint8_t silence;
     uint8_t ram[16];
+    uint64_t cycle;
     struct
     {
         bool full;
@@ -254,7 +254,7 @@ typedef struct
     } volume;
 } dmg_audio_t;
 
-void dmg_audio_clock(dmg_t const dmg);
+void dmg_audio_advance(dmg_t const dmg, uint32_t cycles);
 void dmg_audio_initialize(dmg_t const dmg);
 void dmg_audio_interrupt(dmg_t const dmg);
 void dmg_audio_output(void *context, uint8_t *data, int length);
@@ -5,6 +5,30 @@
 
 #include <system.h>
 
+static void dmg_memory_map(dmg_t const dmg)
+{
+    uint8_t *ram = dmg_mapper_ram(dmg);
+    const uint8_t *rom[] = { dmg_cartridge_rom(dmg, dmg_mapper_bank(dmg, 0x0000)), dmg_cartridge_rom(dmg, dmg_mapper_bank(dmg, 0x4000)) };
+    memset(&dmg->memory.page, 0, sizeof (dmg->memory.page));
+    for (uint16_t page = 0x00; page <= 0x7F; ++page)
+    { /* ROM */
+        dmg->memory.page.read[page] = &rom[page >> 6][(page & 0x3F) << 8];
+    }
+    if (dmg_bootloader_enabled(dmg))
+    { /* BOOTLOADER */
+        dmg->memory.page.read[0x00] = NULL;
+    }
+    for (uint16_t page = 0xA0; ram && (page <= 0xBF); ++page)
+    { /* CARTRIDGE RAM */
+        dmg->memory.page.read[page] = dmg->memory.page.write[page] = &ram[(page - 0xA0) << 8];
+    }
+    for (uint16_t page = 0xC0; page <= 0xFD; ++page)
+    { /* WORK RAM/WORK RAM (MIRROR) */
+        dmg->memory.page.read[page] = dmg->memory.page.write[page] = &dmg->memory.ram.work[((page - 0xC0) & 0x1F) << 8];
+    }
+    dmg_processor_invalidate(dmg);
+}
+
 dmg_error_e dmg_memory_initialize(dmg_t const dmg, const dmg_data_t *const data)
 {
     dmg_error_e result;
@@ -17,6 +41,7 @@ dmg_error_e dmg_memory_initialize(dmg_t const dmg, const dmg_data_t *const data)
         return result;
     }
     dmg_bootloader_initialize(dmg);
+    dmg_memory_map(dmg);
     return result;
 }
 
@@ -58,6 +83,10 @@ void dmg_memory_write(dmg_t const dmg, uint16_t address, uint8_t value)
 {
     switch (address)
     {
+        case 0x0000 ... 0x7FFF: /* MAPPER */
+            dmg_mapper_write(dmg, address, value);
+            dmg_memory_map(dmg);
+            break;
         case 0xC000 ... 0xDFFF: /* WORK RAM */
             dmg->memory.ram.work[address - 0xC000] = value;
             break;
@@ -68,6 +97,7 @@ void dmg_memory_write(dmg_t const dmg, uint16_t address, uint8_t value)
             break;
         case 0xFF50: /* BOOTLOADER */
             dmg_bootloader_write(dmg, address, value);
+            dmg_memory_map(dmg);
             break;
         case 0xFF80 ... 0xFFFE: /* HIGH RAM */
             dmg->memory.ram.high[address - 0xFF80] = value;
@@ -16,6 +16,11 @@ typedef struct
     dmg_cartridge_t cartridge;
     dmg_mapper_t mapper;
     struct
+    {
+        const uint8_t *read[0x100];
+        uint8_t *write[0x100];
+    } page;
+    struct
     {
         uint8_t high[0x80];
         uint8_t work[0x2000];
@@ -249,6 +249,16 @@ dmg_error_e dmg_cartridge_load(dmg_t const dmg, const dmg_data_t *const data)
     return result;
 }
 
+uint8_t *dmg_cartridge_ram(dmg_t const dmg, uint16_t bank)
+{
+    uint8_t *result = NULL;
+    if (dmg->memory.cartridge.ram.data && (bank < dmg->memory.cartridge.ram.count))
+    {
+        result = &dmg->memory.cartridge.ram.data[(bank * 0x2000) + sizeof (dmg_ram_t)];
+    }
+    return result;
+}
+
 uint8_t dmg_cartridge_read_ram(dmg_t const dmg, uint16_t bank, uint16_t address)
 {
     uint8_t result = 0xFF;
@@ -264,6 +274,11 @@ uint8_t dmg_cartridge_read_rom(dmg_t const dmg, uint16_t bank, uint16_t address)
     return dmg->memory.cartridge.rom.data[(bank * 0x4000) + address];
 }
 
+const uint8_t *dmg_cartridge_rom(dmg_t const dmg, uint16_t bank)
+{
+    return &dmg->memory.cartridge.rom.data[bank * 0x4000];
+}
+
 dmg_error_e dmg_cartridge_save(dmg_t const dmg, dmg_data_t *const data)
 {
     if (!data)
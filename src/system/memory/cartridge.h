@@ -25,8 +25,10 @@ typedef struct
 
 dmg_error_e dmg_cartridge_initialize(dmg_t const dmg, const dmg_data_t *const data);
 dmg_error_e dmg_cartridge_load(dmg_t const dmg, const dmg_data_t *const data);
+uint8_t *dmg_cartridge_ram(dmg_t const dmg, uint16_t bank);
 uint8_t dmg_cartridge_read_ram(dmg_t const dmg, uint16_t bank, uint16_t address);
 uint8_t dmg_cartridge_read_rom(dmg_t const dmg, uint16_t bank, uint16_t address);
+const uint8_t *dmg_cartridge_rom(dmg_t const dmg, uint16_t bank);
 dmg_error_e dmg_cartridge_save(dmg_t const dmg, dmg_data_t *const data);
 const char *dmg_cartridge_title(dmg_t const dmg);
 void dmg_cartridge_uninitialize(dmg_t const dmg);
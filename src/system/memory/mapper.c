@@ -5,16 +5,6 @@
 
 #include <system.h>
 
-typedef enum
-{
-    DMG_MAPPER_MBC0 = 0,
-    DMG_MAPPER_MBC1,
-    DMG_MAPPER_MBC2,
-    DMG_MAPPER_MBC3,
-    DMG_MAPPER_MBC5,
-    DMG_MAPPER_MAX,
-} dmg_mapper_e;
-
 typedef struct
 {
     uint8_t id;
@@ -50,6 +40,11 @@ static const dmg_mapper_type_t TYPE[] =
     { 30, DMG_MAPPER_MBC5, { .rtc = false }, },
 };
 
+static const uint16_t BANK[] =
+{
+    0, 1, /* MBC0 */
+};
+
 static dmg_mapper_e dmg_mapper_type(uint8_t id, const dmg_attribute_t **attribute)
 {
     dmg_mapper_e result = DMG_MAPPER_MAX;
@@ -71,48 +66,34 @@ const dmg_attribute_t *dmg_mapper_attribute(dmg_t const dmg)
     return dmg->memory.mapper.attribute;
 }
 
-void dmg_mapper_interrupt(dmg_t const dmg)
+uint16_t dmg_mapper_bank(dmg_t const dmg, uint16_t address)
 {
-    if (dmg->memory.mapper.interrupt)
-    {
-        dmg->memory.mapper.interrupt(dmg);
-    }
+    return dmg->memory.mapper.bank[(address < 0x4000) ? 0 : 1];
 }
 
 dmg_error_e dmg_mapper_initialize(dmg_t const dmg, uint8_t id)
 {
     dmg_error_e result = DMG_SUCCESS;
-    switch (dmg_mapper_type(id, &dmg->memory.mapper.attribute))
+    switch ((dmg->memory.mapper.type = dmg_mapper_type(id, &dmg->memory.mapper.attribute)))
     {
         case DMG_MAPPER_MBC0:
-            dmg->memory.mapper.read = dmg_mbc0_read;
-            dmg->memory.mapper.write = dmg_mbc0_write;
+            dmg->memory.mapper.bank = BANK;
             break;
         case DMG_MAPPER_MBC1:
             dmg_mbc1_initialize(dmg);
-            dmg->memory.mapper.read = dmg_mbc1_read;
-            dmg->memory.mapper.write = dmg_mbc1_write;
+            dmg->memory.mapper.bank = dmg->memory.mapper.mbc1.rom.bank;
             break;
         case DMG_MAPPER_MBC2:
             dmg_mbc2_initialize(dmg);
-            dmg->memory.mapper.read = dmg_mbc2_read;
-            dmg->memory.mapper.write = dmg_mbc2_write;
+            dmg->memory.mapper.bank = dmg->memory.mapper.mbc2.rom.bank;
             break;
         case DMG_MAPPER_MBC3:
             dmg_mbc3_initialize(dmg, dmg->memory.mapper.attribute->rtc);
-            if (dmg->memory.mapper.attribute->rtc)
-            {
-                dmg->memory.mapper.interrupt = dmg_mbc3_interrupt;
-                dmg->memory.mapper.load = dmg_mbc3_load;
-                dmg->memory.mapper.save = dmg_mbc3_save;
-            }
-            dmg->memory.mapper.read = dmg_mbc3_read;
-            dmg->memory.mapper.write = dmg_mbc3_write;
+            dmg->memory.mapper.bank = dmg->memory.mapper.mbc3.rom.bank;
             break;
         case DMG_MAPPER_MBC5:
             dmg_mbc5_initialize(dmg);
-            dmg->memory.mapper.read = dmg_mbc5_read;
-            dmg->memory.mapper.write = dmg_mbc5_write;
+            dmg->memory.mapper.bank = dmg->memory.mapper.mbc5.rom.bank;
             break;
         default:
             result = DMG_ERROR(dmg, "Unsupported mapper type -- %u", id);
@@ -123,26 +104,89 @@ dmg_error_e dmg_mapper_initialize(dmg_t const dmg, uint8_t id)
 
 void dmg_mapper_load(dmg_t const dmg, const void *const data, uint32_t length)
 {
-    if (dmg->memory.mapper.load)
+    if ((dmg->memory.mapper.type == DMG_MAPPER_MBC3) && dmg->memory.mapper.attribute->rtc)
     {
-        dmg->memory.mapper.load(dmg, data, length);
+        dmg_mbc3_load(dmg, data, length);
+    }
+}
+
+uint8_t *dmg_mapper_ram(dmg_t const dmg)
+{
+    uint8_t *result = NULL;
+    switch (dmg->memory.mapper.type)
+    {
+        case DMG_MAPPER_MBC0:
+            result = dmg_mbc0_ram(dmg);
+            break;
+        case DMG_MAPPER_MBC1:
+            result = dmg_mbc1_ram(dmg);
+            break;
+        case DMG_MAPPER_MBC3:
+            result = dmg_mbc3_ram(dmg);
+            break;
+        case DMG_MAPPER_MBC5:
+            result = dmg_mbc5_ram(dmg);
+            break;
+        default: /* MBC2 */
+            break;
     }
+    return result;
 }
 
 uint8_t dmg_mapper_read(dmg_t const dmg, uint16_t address)
 {
-    return dmg->memory.mapper.read(dmg, address);
+    uint8_t result = 0xFF;
+    switch (dmg->memory.mapper.type)
+    {
+        case DMG_MAPPER_MBC0:
+            result = dmg_mbc0_read(dmg, address);
+            break;
+        case DMG_MAPPER_MBC1:
+            result = dmg_mbc1_read(dmg, address);
+            break;
+        case DMG_MAPPER_MBC2:
+            result = dmg_mbc2_read(dmg, address);
+            break;
+        case DMG_MAPPER_MBC3:
+            result = dmg_mbc3_read(dmg, address);
+            break;
+        case DMG_MAPPER_MBC5:
+            result = dmg_mbc5_read(dmg, address);
+            break;
+        default:
+            break;
+    }
+    return result;
 }
 
 void dmg_mapper_save(dmg_t const dmg, void *const data, uint32_t length)
 {
-    if (dmg->memory.mapper.save)
+    if ((dmg->memory.mapper.type == DMG_MAPPER_MBC3) && dmg->memory.mapper.attribute->rtc)
     {
-        dmg->memory.mapper.save(dmg, data, length);
+        dmg_mbc3_save(dmg, data, length);
     }
 }
 
 void dmg_mapper_write(dmg_t const dmg, uint16_t address, uint8_t value)
 {
-    dmg->memory.mapper.write(dmg, address, value);
+    switch (dmg->memory.mapper.type)
+    {
+        case DMG_MAPPER_MBC0:
+            dmg_mbc0_write(dmg, address, value);
+            break;
+        case DMG_MAPPER_MBC1:
+            dmg_mbc1_write(dmg, address, value);
+            break;
+        case DMG_MAPPER_MBC2:
+            dmg_mbc2_write(dmg, address, value);
+            break;
+        case DMG_MAPPER_MBC3:
+            dmg_mbc3_write(dmg, address, value);
+            break;
+        case DMG_MAPPER_MBC5:
+            dmg_mbc5_write(dmg, address, value);
+            break;
+        default:
+            break;
+    }
 }
@@ -12,6 +12,16 @@
 #include <mbc3.h>
 #include <mbc5.h>
 
+typedef enum
+{
+    DMG_MAPPER_MBC0 = 0,
+    DMG_MAPPER_MBC1,
+    DMG_MAPPER_MBC2,
+    DMG_MAPPER_MBC3,
+    DMG_MAPPER_MBC5,
+    DMG_MAPPER_MAX,
+} dmg_mapper_e;
+
 typedef union
 {
     struct
@@ -24,11 +34,8 @@ typedef union
 typedef struct
 {
     const dmg_attribute_t *attribute;
-    void (*interrupt)(dmg_t const dmg);
-    void (*load)(dmg_t const dmg, const void *const data, uint32_t length);
-    uint8_t (*read)(dmg_t const dmg, uint16_t address);
-    void (*save)(dmg_t const dmg, void *const data, uint32_t length);
-    void (*write)(dmg_t const dmg, uint16_t address, uint8_t value);
+    const uint16_t *bank;
+    dmg_mapper_e type;
     union
     {
         dmg_mbc1_t mbc1;
@@ -39,9 +46,10 @@ typedef struct
 } dmg_mapper_t;
 
 const dmg_attribute_t *dmg_mapper_attribute(dmg_t const dmg);
+uint16_t dmg_mapper_bank(dmg_t const dmg, uint16_t address);
 dmg_error_e dmg_mapper_initialize(dmg_t const dmg, uint8_t id);
-void dmg_mapper_interrupt(dmg_t const dmg);
 void dmg_mapper_load(dmg_t const dmg, const void *const data, uint32_t length);
+uint8_t *dmg_mapper_ram(dmg_t const dmg);
 uint8_t dmg_mapper_read(dmg_t const dmg, uint16_t address);
 void dmg_mapper_save(dmg_t const dmg, void *const data, uint32_t length);
 void dmg_mapper_write(dmg_t const dmg, uint16_t address, uint8_t value);
@@ -5,6 +5,11 @@
 
 #include <system.h>
 
+uint8_t *dmg_mbc0_ram(dmg_t const dmg)
+{
+    return dmg_cartridge_ram(dmg, 0);
+}
+
 uint8_t dmg_mbc0_read(dmg_t const dmg, uint16_t address)
 {
     uint8_t result = 0xFF;
@@ -8,6 +8,7 @@
 
 #include <common.h>
 
+uint8_t *dmg_mbc0_ram(dmg_t const dmg);
 uint8_t dmg_mbc0_read(dmg_t const dmg, uint16_t address);
 void dmg_mbc0_write(dmg_t const dmg, uint16_t address, uint8_t value);
 
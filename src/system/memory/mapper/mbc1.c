@@ -47,6 +47,16 @@ void dmg_mbc1_initialize(dmg_t const dmg)
     dmg_mbc1_update(dmg);
 }
 
+uint8_t *dmg_mbc1_ram(dmg_t const dmg)
+{
+    uint8_t *result = NULL;
+    if (dmg->memory.mapper.mbc1.ram.enabled)
+    {
+        result = dmg_cartridge_ram(dmg, dmg->memory.mapper.mbc1.ram.bank);
+    }
+    return result;
+}
+
 uint8_t dmg_mbc1_read(dmg_t const dmg, uint16_t address)
 {
     uint8_t result = 0xFF;
@@ -28,6 +28,7 @@ typedef struct
 } dmg_mbc1_t;
 
 void dmg_mbc1_initialize(dmg_t const dmg);
+uint8_t *dmg_mbc1_ram(dmg_t const dmg);
 uint8_t dmg_mbc1_read(dmg_t const dmg, uint16_t address);
 void dmg_mbc1_write(dmg_t const dmg, uint16_t address, uint8_t value);
 
@@ -73,8 +73,26 @@ static void dmg_mbc3_update_rtc(dmg_t const dmg)
     }
 }
 
+static void dmg_mbc3_sync_rtc(dmg_t const dmg)
+{
+    uint64_t cycle = dmg_system_cycle(dmg);
+    if (!dmg->memory.mapper.mbc3.rtc.counter[0].day.halt)
+    { /* ADVANCE BY THE CYCLES ELAPSED SINCE THE LAST ACCESS */
+        uint64_t elapsed = cycle - dmg->memory.mapper.mbc3.rtc.cycle;
+        while (elapsed >= dmg->memory.mapper.mbc3.rtc.delay)
+        {
+            elapsed -= dmg->memory.mapper.mbc3.rtc.delay;
+            dmg_mbc3_update_rtc(dmg);
+            dmg->memory.mapper.mbc3.rtc.delay = 4194304; /* 1Hz */
+        }
+        dmg->memory.mapper.mbc3.rtc.delay -= elapsed;
+    }
+    dmg->memory.mapper.mbc3.rtc.cycle = cycle;
+}
+
 static void dmg_mbc3_write_rtc(dmg_t const dmg, uint8_t value)
 {
+    dmg_mbc3_sync_rtc(dmg);
     switch(dmg->memory.mapper.mbc3.bank.rtc)
     {
         case 0x08: /* SECONDS */
@@ -103,25 +121,22 @@ void dmg_mbc3_initialize(dmg_t const dmg, bool enabled)
     dmg_mbc3_update(dmg);
 }
 
-void dmg_mbc3_interrupt(dmg_t const dmg)
+void dmg_mbc3_load(dmg_t const dmg, const void *const data, uint32_t length)
 {
-    if (dmg->memory.mapper.mbc3.rtc.enabled && !dmg->memory.mapper.mbc3.rtc.counter[0].day.halt)
+    if (length == sizeof (*dmg->memory.mapper.mbc3.rtc.counter))
     {
-        if (!dmg->memory.mapper.mbc3.rtc.delay)
-        {
-            dmg_mbc3_update_rtc(dmg);
-            dmg->memory.mapper.mbc3.rtc.delay = 1024; /* 1Hz */
-        }
-        --dmg->memory.mapper.mbc3.rtc.delay;
+        memcpy(&dmg->memory.mapper.mbc3.rtc.counter[0], data, length);
     }
 }
 
-void dmg_mbc3_load(dmg_t const dmg, const void *const data, uint32_t length)
+uint8_t *dmg_mbc3_ram(dmg_t const dmg)
 {
-    if (length == sizeof (*dmg->memory.mapper.mbc3.rtc.counter))
-    {
-        memcpy(&dmg->memory.mapper.mbc3.rtc.counter[0], data, length);
+    uint8_t *result = NULL;
+    if (dmg->memory.mapper.mbc3.enabled && !(dmg->memory.mapper.mbc3.rtc.enabled && dmg->memory.mapper.mbc3.bank.rtc))
+    { /* RAM 0-3 */
+        result = dmg_cartridge_ram(dmg, dmg->memory.mapper.mbc3.ram.bank);
     }
+    return result;
 }
 
 uint8_t dmg_mbc3_read(dmg_t const dmg, uint16_t address)
@@ -158,6 +173,7 @@ void dmg_mbc3_save(dmg_t const dmg, void *const data, uint32_t length)
 {
     if (length == sizeof (*dmg->memory.mapper.mbc3.rtc.counter))
     {
+        dmg_mbc3_sync_rtc(dmg);
         memcpy(data, &dmg->memory.mapper.mbc3.rtc.counter[0], length);
     }
 }
@@ -195,6 +211,7 @@ void dmg_mbc3_write(dmg_t const dmg, uint16_t address, uint8_t value)
                 else if (value && dmg->memory.mapper.mbc3.rtc.latched)
                 {
                     dmg->memory.mapper.mbc3.rtc.latched = false;
+                    dmg_mbc3_sync_rtc(dmg);
                     dmg_mbc3_latch_rtc(dmg);
                 }
             }
@@ -78,7 +78,8 @@ typedef struct
     } rom;
     struct
     {
-        int16_t delay;
+        uint64_t cycle;
+        uint32_t delay;
         bool enabled;
         bool latched;
         dmg_rtc_t counter[2];
@@ -86,8 +87,8 @@ typedef struct
 } dmg_mbc3_t;
 
 void dmg_mbc3_initialize(dmg_t const dmg, bool enabled);
-void dmg_mbc3_interrupt(dmg_t const dmg);
 void dmg_mbc3_load(dmg_t const dmg, const void *const data, uint32_t length);
+uint8_t *dmg_mbc3_ram(dmg_t const dmg);
 uint8_t dmg_mbc3_read(dmg_t const dmg, uint16_t address);
 void dmg_mbc3_save(dmg_t const dmg, void *const data, uint32_t length);
 void dmg_mbc3_write(dmg_t const dmg, uint16_t address, uint8_t value);
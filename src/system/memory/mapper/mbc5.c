@@ -19,6 +19,16 @@ void dmg_mbc5_initialize(dmg_t const dmg)
     dmg_mbc5_update(dmg);
 }
 
+uint8_t *dmg_mbc5_ram(dmg_t const dmg)
+{
+    uint8_t *result = NULL;
+    if (dmg->memory.mapper.mbc5.ram.enabled)
+    {
+        result = dmg_cartridge_ram(dmg, dmg->memory.mapper.mbc5.ram.bank);
+    }
+    return result;
+}
+
 uint8_t dmg_mbc5_read(dmg_t const dmg, uint16_t address)
 {
     uint8_t result = 0xFF;
@@ -31,6 +31,7 @@ typedef struct
 } dmg_mbc5_t;
 
 void dmg_mbc5_initialize(dmg_t const dmg);
+uint8_t *dmg_mbc5_ram(dmg_t const dmg);
 uint8_t dmg_mbc5_read(dmg_t const dmg, uint16_t address);
 void dmg_mbc5_write(dmg_t const dmg, uint16_t address, uint8_t value);
 
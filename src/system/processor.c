@@ -3,122 +3,889 @@
  * SPDX-License-Identifier: MIT
  */
 
+#define _DEFAULT_SOURCE /* MAP_ANONYMOUS */
+
 #include <system.h>
 
+#ifdef DMG_JIT
+#include <stddef.h>
+#include <sys/mman.h>
+
+#define DMG_JIT_ARENA 0x800000
+#define DMG_JIT_INSTRUCTION 160
+#define DMG_JIT_LENGTH 32
+#define DMG_JIT_PAGE 0x1000
+#define DMG_JIT_THRESHOLD 16
+
+#define DMG_OFFSET(_FIELD_) ((uint32_t)offsetof(struct dmg_s, _FIELD_))
+#endif /* DMG_JIT */
+
 typedef void (*dmg_instruction_f)(dmg_t const dmg);
 
-static void dmg_processor_instruction_adc(dmg_t const dmg)
+typedef struct
 {
-    uint16_t sum;
-    uint8_t carry, operand = 0;
-    dmg->processor.delay = 4;
-    switch (dmg->processor.instruction.opcode)
+    const char *mnemonic;
+    const char *flags;
+    uint8_t length;
+    uint8_t cycles;
+    uint8_t branch;
+} dmg_opcode_t;
+
+#define DMG_CONDITION(_CONDITION_) (DMG_CONDITION_##_CONDITION_)
+#define DMG_CONDITION_C dmg_processor_carry(dmg)
+#define DMG_CONDITION_N true
+#define DMG_CONDITION_NC !dmg_processor_carry(dmg)
+#define DMG_CONDITION_NZ !dmg_processor_zero(dmg)
+#define DMG_CONDITION_Z dmg_processor_zero(dmg)
+
+#define DMG_REGISTER(_REGISTER_) dmg->processor.DMG_REGISTER_##_REGISTER_
+#define DMG_REGISTER_A af.high
+#define DMG_REGISTER_AF af
+#define DMG_REGISTER_B bc.high
+#define DMG_REGISTER_BC bc
+#define DMG_REGISTER_C bc.low
+#define DMG_REGISTER_D de.high
+#define DMG_REGISTER_DE de
+#define DMG_REGISTER_E de.low
+#define DMG_REGISTER_H hl.high
+#define DMG_REGISTER_HL hl
+#define DMG_REGISTER_L hl.low
+#define DMG_REGISTER_SP sp
+
+#define DMG_OPERAND dmg->processor.instruction.operand
+#define DMG_READ(_ADDRESS_) dmg_system_read(dmg, _ADDRESS_)
+#define DMG_READ_WORD(_ADDRESS_) dmg_system_read_word(dmg, _ADDRESS_)
+#define DMG_WRITE(_ADDRESS_, _VALUE_) dmg_system_write(dmg, _ADDRESS_, _VALUE_)
+#define DMG_WRITE_WORD(_ADDRESS_, _VALUE_) dmg_system_write_word(dmg, _ADDRESS_, _VALUE_)
+
+/* TEMPLATES, EXPANDED ONCE PER OPCODE WITH OPERANDS AND CYCLES FIXED BY THE TABLES BELOW */
+#define DMG_INSTRUCTION_ADD_HL_RR(_REGISTER_) \
+    dmg_processor_add_hl(dmg, DMG_REGISTER(_REGISTER_).word);
+#define DMG_INSTRUCTION_ADD_SP_N() \
+    dmg->processor.sp.word = dmg_processor_add_sp(dmg, DMG_OPERAND.low);
+#define DMG_INSTRUCTION_ALU_HL(_OPERATION_) \
+    dmg_processor_##_OPERATION_(dmg, DMG_READ(dmg->processor.hl.word));
+#define DMG_INSTRUCTION_ALU_N(_OPERATION_) \
+    dmg_processor_##_OPERATION_(dmg, DMG_OPERAND.low);
+#define DMG_INSTRUCTION_ALU_R(_OPERATION_, _REGISTER_) \
+    dmg_processor_##_OPERATION_(dmg, DMG_REGISTER(_REGISTER_));
+#define DMG_INSTRUCTION_BIT_HL(_BIT_) \
+    dmg_processor_bit(dmg, DMG_READ(dmg->processor.hl.word), _BIT_);
+#define DMG_INSTRUCTION_BIT_R(_BIT_, _REGISTER_) \
+    dmg_processor_bit(dmg, DMG_REGISTER(_REGISTER_), _BIT_);
+#define DMG_INSTRUCTION_CALL(_CONDITION_) \
+    if (DMG_CONDITION(_CONDITION_)) \
+    { \
+        dmg->processor.delay = DMG_BRANCH; \
+        dmg->processor.sp.word -= 2; \
+        DMG_WRITE_WORD(dmg->processor.sp.word, dmg->processor.pc.word); \
+        dmg->processor.pc.word = DMG_OPERAND.word; \
+    }
+#define DMG_INSTRUCTION_CCF() \
+    dmg_processor_flags(dmg); \
+    dmg->processor.af.carry = !dmg->processor.af.carry; \
+    dmg->processor.af.half_carry = false; \
+    dmg->processor.af.negative = false;
+#define DMG_INSTRUCTION_CPL() \
+    dmg_processor_flags(dmg); \
+    dmg->processor.af.high = ~dmg->processor.af.high; \
+    dmg->processor.af.half_carry = true; \
+    dmg->processor.af.negative = true;
+#define DMG_INSTRUCTION_DAA() \
+    dmg_processor_daa(dmg);
+#define DMG_INSTRUCTION_DEC_RR(_REGISTER_) \
+    --DMG_REGISTER(_REGISTER_).word;
+#define DMG_INSTRUCTION_DI() \
+    dmg->processor.interrupt.enable_delay = 0; \
+    dmg->processor.interrupt.enabled = false;
+#define DMG_INSTRUCTION_EI() \
+    if (!dmg->processor.interrupt.enable_delay) \
+    { \
+        dmg->processor.interrupt.enable_delay = 2; \
+    }
+#define DMG_INSTRUCTION_HALT() \
+    dmg->processor.halted = true;
+#define DMG_INSTRUCTION_INC_RR(_REGISTER_) \
+    ++DMG_REGISTER(_REGISTER_).word;
+#ifndef NDEBUG
+#define DMG_INSTRUCTION_INVALID() \
+    fprintf(stderr, "Invalid opcode -- [%04X] %02X", dmg->processor.instruction.address, dmg->processor.instruction.opcode);
+#else
+#define DMG_INSTRUCTION_INVALID()
+#endif /* NDEBUG */
+#define DMG_INSTRUCTION_JP(_CONDITION_) \
+    if (DMG_CONDITION(_CONDITION_)) \
+    { \
+        dmg->processor.delay = DMG_BRANCH; \
+        dmg->processor.pc.word = DMG_OPERAND.word; \
+    }
+#define DMG_INSTRUCTION_JP_HL() \
+    dmg->processor.pc.word = dmg->processor.hl.word;
+#define DMG_INSTRUCTION_JR(_CONDITION_) \
+    if (DMG_CONDITION(_CONDITION_)) \
+    { \
+        dmg->processor.delay = DMG_BRANCH; \
+        dmg->processor.pc.word += (int8_t)DMG_OPERAND.low; \
+        if (DMG_OPERAND.low & 0x80) \
+        { \
+            dmg_processor_idle(dmg); \
+        } \
+    }
+#define DMG_INSTRUCTION_LD_A_FFC() \
+    dmg->processor.af.high = DMG_READ(0xFF00 + dmg->processor.bc.low);
+#define DMG_INSTRUCTION_LD_A_FFN() \
+    dmg->processor.af.high = DMG_READ(0xFF00 + DMG_OPERAND.low);
+#define DMG_INSTRUCTION_LD_A_HLS(_STEP_) \
+    dmg->processor.af.high = DMG_READ(dmg->processor.hl.word _STEP_);
+#define DMG_INSTRUCTION_LD_A_NN() \
+    dmg->processor.af.high = DMG_READ(DMG_OPERAND.word);
+#define DMG_INSTRUCTION_LD_A_RR(_REGISTER_) \
+    dmg->processor.af.high = DMG_READ(DMG_REGISTER(_REGISTER_).word);
+#define DMG_INSTRUCTION_LD_FFC_A() \
+    DMG_WRITE(0xFF00 + dmg->processor.bc.low, dmg->processor.af.high);
+#define DMG_INSTRUCTION_LD_FFN_A() \
+    DMG_WRITE(0xFF00 + DMG_OPERAND.low, dmg->processor.af.high);
+#define DMG_INSTRUCTION_LD_HL_N() \
+    DMG_WRITE(dmg->processor.hl.word, DMG_OPERAND.low);
+#define DMG_INSTRUCTION_LD_HL_R(_REGISTER_) \
+    DMG_WRITE(dmg->processor.hl.word, DMG_REGISTER(_REGISTER_));
+#define DMG_INSTRUCTION_LD_HL_SPN() \
+    dmg->processor.hl.word = dmg_processor_add_sp(dmg, DMG_OPERAND.low);
+#define DMG_INSTRUCTION_LD_HLS_A(_STEP_) \
+    DMG_WRITE(dmg->processor.hl.word _STEP_, dmg->processor.af.high);
+#define DMG_INSTRUCTION_LD_NN_A() \
+    DMG_WRITE(DMG_OPERAND.word, dmg->processor.af.high);
+#define DMG_INSTRUCTION_LD_NN_SP() \
+    DMG_WRITE(DMG_OPERAND.word, dmg->processor.sp.low); \
+    DMG_WRITE(DMG_OPERAND.word + 1, dmg->processor.sp.high);
+#define DMG_INSTRUCTION_LD_R_HL(_REGISTER_) \
+    DMG_REGISTER(_REGISTER_) = DMG_READ(dmg->processor.hl.word);
+#define DMG_INSTRUCTION_LD_R_N(_REGISTER_) \
+    DMG_REGISTER(_REGISTER_) = DMG_OPERAND.low;
+#define DMG_INSTRUCTION_LD_R_R(_DESTINATION_, _SOURCE_) \
+    DMG_REGISTER(_DESTINATION_) = DMG_REGISTER(_SOURCE_);
+#define DMG_INSTRUCTION_LD_RR_A(_REGISTER_) \
+    DMG_WRITE(DMG_REGISTER(_REGISTER_).word, dmg->processor.af.high);
+#define DMG_INSTRUCTION_LD_RR_NN(_REGISTER_) \
+    DMG_REGISTER(_REGISTER_).word = DMG_OPERAND.word;
+#define DMG_INSTRUCTION_LD_SP_HL() \
+    dmg->processor.sp.word = dmg->processor.hl.word;
+#define DMG_INSTRUCTION_MODIFY_HL(_OPERATION_) \
+    DMG_WRITE(dmg->processor.hl.word, dmg_processor_##_OPERATION_(dmg, DMG_READ(dmg->processor.hl.word)));
+#define DMG_INSTRUCTION_MODIFY_R(_OPERATION_, _REGISTER_) \
+    DMG_REGISTER(_REGISTER_) = dmg_processor_##_OPERATION_(dmg, DMG_REGISTER(_REGISTER_));
+#define DMG_INSTRUCTION_NOP()
+#define DMG_INSTRUCTION_POP(_REGISTER_) \
+    DMG_REGISTER(_REGISTER_).word = DMG_READ_WORD(dmg->processor.sp.word); \
+    dmg->processor.sp.word += 2;
+#define DMG_INSTRUCTION_POP_AF() \
+    dmg->processor.af.word = DMG_READ_WORD(dmg->processor.sp.word) & 0xFFF0; \
+    dmg->processor.sp.word += 2; \
+    dmg->processor.flag.operation = DMG_FLAG_NONE;
+#define DMG_INSTRUCTION_PUSH(_REGISTER_) \
+    dmg->processor.sp.word -= 2; \
+    DMG_WRITE_WORD(dmg->processor.sp.word, DMG_REGISTER(_REGISTER_).word);
+#define DMG_INSTRUCTION_PUSH_AF() \
+    dmg_processor_flags(dmg); \
+    DMG_INSTRUCTION_PUSH(AF)
+#define DMG_INSTRUCTION_RES_HL(_BIT_) \
+    DMG_WRITE(dmg->processor.hl.word, DMG_READ(dmg->processor.hl.word) & ~(1 << _BIT_));
+#define DMG_INSTRUCTION_RES_R(_BIT_, _REGISTER_) \
+    DMG_REGISTER(_REGISTER_) &= ~(1 << _BIT_);
+#define DMG_INSTRUCTION_RET(_CONDITION_) \
+    if (DMG_CONDITION(_CONDITION_)) \
+    { \
+        dmg->processor.delay = DMG_BRANCH; \
+        dmg->processor.pc.word = DMG_READ_WORD(dmg->processor.sp.word); \
+        dmg->processor.sp.word += 2; \
+    }
+#define DMG_INSTRUCTION_RETI() \
+    dmg->processor.pc.word = DMG_READ_WORD(dmg->processor.sp.word); \
+    dmg->processor.sp.word += 2; \
+    dmg->processor.interrupt.enable_delay = 0; \
+    dmg->processor.interrupt.enabled = true;
+#define DMG_INSTRUCTION_ROTATE_A(_OPERATION_) \
+    dmg->processor.af.high = dmg_processor_##_OPERATION_(dmg, dmg->processor.af.high); \
+    dmg->processor.flag.operation = DMG_FLAG_ROTATE;
+#define DMG_INSTRUCTION_RST(_ADDRESS_) \
+    dmg->processor.sp.word -= 2; \
+    DMG_WRITE_WORD(dmg->processor.sp.word, dmg->processor.pc.word); \
+    dmg->processor.pc.word = _ADDRESS_;
+#define DMG_INSTRUCTION_SCF() \
+    dmg_processor_flags(dmg); \
+    dmg->processor.af.carry = true; \
+    dmg->processor.af.half_carry = false; \
+    dmg->processor.af.negative = false;
+#define DMG_INSTRUCTION_SET_HL(_BIT_) \
+    DMG_WRITE(dmg->processor.hl.word, DMG_READ(dmg->processor.hl.word) | (1 << _BIT_));
+#define DMG_INSTRUCTION_SET_R(_BIT_, _REGISTER_) \
+    DMG_REGISTER(_REGISTER_) |= (1 << _BIT_);
+#define DMG_INSTRUCTION_STOP() \
+    dmg->processor.stopped = true;
+
+#define DMG_INSTRUCTION(_OPCODE_, _TEMPLATE_, _LENGTH_, _CYCLES_, _BRANCH_, _FLAGS_, _MNEMONIC_, ...) \
+    static void dmg_processor_instruction_##_OPCODE_(dmg_t const dmg) \
+    { \
+        enum { DMG_BRANCH = _BRANCH_ }; \
+        dmg->processor.delay = _CYCLES_; \
+        DMG_INSTRUCTION_##_TEMPLATE_(__VA_ARGS__) \
+    }
+
+#define DMG_INSTRUCTION_EXTENDED(_OPCODE_, _TEMPLATE_, _LENGTH_, _CYCLES_, _BRANCH_, _FLAGS_, _MNEMONIC_, ...) \
+    static void dmg_processor_instruction_extended_##_OPCODE_(dmg_t const dmg) \
+    { \
+        enum { DMG_BRANCH = _BRANCH_ }; \
+        dmg->processor.delay = _CYCLES_; \
+        DMG_INSTRUCTION_##_TEMPLATE_(__VA_ARGS__) \
+    }
+
+/* OPCODE, TEMPLATE, LENGTH, CYCLES, BRANCH CYCLES, FLAGS (ZNHC), MNEMONIC, OPERANDS */
+#define DMG_PROCESSOR_INSTRUCTION(_X_) \
+    _X_(00, NOP, 1, 4, 0, "----", "NOP") \
+    _X_(01, LD_RR_NN, 3, 12, 0, "----", "LD BC,n16", BC) \
+    _X_(02, LD_RR_A, 1, 8, 0, "----", "LD (BC),A", BC) \
+    _X_(03, INC_RR, 1, 8, 0, "----", "INC BC", BC) \
+    _X_(04, MODIFY_R, 1, 4, 0, "Z0H-", "INC B", inc, B) \
+    _X_(05, MODIFY_R, 1, 4, 0, "Z1H-", "DEC B", dec, B) \
+    _X_(06, LD_R_N, 2, 8, 0, "----", "LD B,n8", B) \
+    _X_(07, ROTATE_A, 1, 4, 0, "000C", "RLCA", rlc) \
+    _X_(08, LD_NN_SP, 3, 20, 0, "----", "LD (a16),SP") \
+    _X_(09, ADD_HL_RR, 1, 8, 0, "-0HC", "ADD HL,BC", BC) \
+    _X_(0A, LD_A_RR, 1, 8, 0, "----", "LD A,(BC)", BC) \
+    _X_(0B, DEC_RR, 1, 8, 0, "----", "DEC BC", BC) \
+    _X_(0C, MODIFY_R, 1, 4, 0, "Z0H-", "INC C", inc, C) \
+    _X_(0D, MODIFY_R, 1, 4, 0, "Z1H-", "DEC C", dec, C) \
+    _X_(0E, LD_R_N, 2, 8, 0, "----", "LD C,n8", C) \
+    _X_(0F, ROTATE_A, 1, 4, 0, "000C", "RRCA", rrc) \
+    _X_(10, STOP, 2, 4, 4, "----", "STOP") \
+    _X_(11, LD_RR_NN, 3, 12, 0, "----", "LD DE,n16", DE) \
+    _X_(12, LD_RR_A, 1, 8, 0, "----", "LD (DE),A", DE) \
+    _X_(13, INC_RR, 1, 8, 0, "----", "INC DE", DE) \
+    _X_(14, MODIFY_R, 1, 4, 0, "Z0H-", "INC D", inc, D) \
+    _X_(15, MODIFY_R, 1, 4, 0, "Z1H-", "DEC D", dec, D) \
+    _X_(16, LD_R_N, 2, 8, 0, "----", "LD D,n8", D) \
+    _X_(17, ROTATE_A, 1, 4, 0, "000C", "RLA", rl) \
+    _X_(18, JR, 2, 8, 12, "----", "JR e8", N) \
+    _X_(19, ADD_HL_RR, 1, 8, 0, "-0HC", "ADD HL,DE", DE) \
+    _X_(1A, LD_A_RR, 1, 8, 0, "----", "LD A,(DE)", DE) \
+    _X_(1B, DEC_RR, 1, 8, 0, "----", "DEC DE", DE) \
+    _X_(1C, MODIFY_R, 1, 4, 0, "Z0H-", "INC E", inc, E) \
+    _X_(1D, MODIFY_R, 1, 4, 0, "Z1H-", "DEC E", dec, E) \
+    _X_(1E, LD_R_N, 2, 8, 0, "----", "LD E,n8", E) \
+    _X_(1F, ROTATE_A, 1, 4, 0, "000C", "RRA", rr) \
+    _X_(20, JR, 2, 8, 12, "----", "JR NZ,e8", NZ) \
+    _X_(21, LD_RR_NN, 3, 12, 0, "----", "LD HL,n16", HL) \
+    _X_(22, LD_HLS_A, 1, 8, 0, "----", "LD (HL+),A", ++) \
+    _X_(23, INC_RR, 1, 8, 0, "----", "INC HL", HL) \
+    _X_(24, MODIFY_R, 1, 4, 0, "Z0H-", "INC H", inc, H) \
+    _X_(25, MODIFY_R, 1, 4, 0, "Z1H-", "DEC H", dec, H) \
+    _X_(26, LD_R_N, 2, 8, 0, "----", "LD H,n8", H) \
+    _X_(27, DAA, 1, 4, 0, "Z-0C", "DAA") \
+    _X_(28, JR, 2, 8, 12, "----", "JR Z,e8", Z) \
+    _X_(29, ADD_HL_RR, 1, 8, 0, "-0HC", "ADD HL,HL", HL) \
+    _X_(2A, LD_A_HLS, 1, 8, 0, "----", "LD A,(HL+)", ++) \
+    _X_(2B, DEC_RR, 1, 8, 0, "----", "DEC HL", HL) \
+    _X_(2C, MODIFY_R, 1, 4, 0, "Z0H-", "INC L", inc, L) \
+    _X_(2D, MODIFY_R, 1, 4, 0, "Z1H-", "DEC L", dec, L) \
+    _X_(2E, LD_R_N, 2, 8, 0, "----", "LD L,n8", L) \
+    _X_(2F, CPL, 1, 4, 0, "-11-", "CPL") \
+    _X_(30, JR, 2, 8, 12, "----", "JR NC,e8", NC) \
+    _X_(31, LD_RR_NN, 3, 12, 0, "----", "LD SP,n16", SP) \
+    _X_(32, LD_HLS_A, 1, 8, 0, "----", "LD (HL-),A", --) \
+    _X_(33, INC_RR, 1, 8, 0, "----", "INC SP", SP) \
+    _X_(34, MODIFY_HL, 1, 12, 0, "Z0H-", "INC (HL)", inc) \
+    _X_(35, MODIFY_HL, 1, 12, 0, "Z1H-", "DEC (HL)", dec) \
+    _X_(36, LD_HL_N, 2, 12, 0, "----", "LD (HL),n8") \
+    _X_(37, SCF, 1, 4, 0, "-001", "SCF") \
+    _X_(38, JR, 2, 8, 12, "----", "JR C,e8", C) \
+    _X_(39, ADD_HL_RR, 1, 8, 0, "-0HC", "ADD HL,SP", SP) \
+    _X_(3A, LD_A_HLS, 1, 8, 0, "----", "LD A,(HL-)", --) \
+    _X_(3B, DEC_RR, 1, 8, 0, "----", "DEC SP", SP) \
+    _X_(3C, MODIFY_R, 1, 4, 0, "Z0H-", "INC A", inc, A) \
+    _X_(3D, MODIFY_R, 1, 4, 0, "Z1H-", "DEC A", dec, A) \
+    _X_(3E, LD_R_N, 2, 8, 0, "----", "LD A,n8", A) \
+    _X_(3F, CCF, 1, 4, 0, "-00C", "CCF") \
+    _X_(40, LD_R_R, 1, 4, 0, "----", "LD B,B", B, B) \
+    _X_(41, LD_R_R, 1, 4, 0, "----", "LD B,C", B, C) \
+    _X_(42, LD_R_R, 1, 4, 0, "----", "LD B,D", B, D) \
+    _X_(43, LD_R_R, 1, 4, 0, "----", "LD B,E", B, E) \
+    _X_(44, LD_R_R, 1, 4, 0, "----", "LD B,H", B, H) \
+    _X_(45, LD_R_R, 1, 4, 0, "----", "LD B,L", B, L) \
+    _X_(46, LD_R_HL, 1, 8, 0, "----", "LD B,(HL)", B) \
+    _X_(47, LD_R_R, 1, 4, 0, "----", "LD B,A", B, A) \
+    _X_(48, LD_R_R, 1, 4, 0, "----", "LD C,B", C, B) \
+    _X_(49, LD_R_R, 1, 4, 0, "----", "LD C,C", C, C) \
+    _X_(4A, LD_R_R, 1, 4, 0, "----", "LD C,D", C, D) \
+    _X_(4B, LD_R_R, 1, 4, 0, "----", "LD C,E", C, E) \
+    _X_(4C, LD_R_R, 1, 4, 0, "----", "LD C,H", C, H) \
+    _X_(4D, LD_R_R, 1, 4, 0, "----", "LD C,L", C, L) \
+    _X_(4E, LD_R_HL, 1, 8, 0, "----", "LD C,(HL)", C) \
+    _X_(4F, LD_R_R, 1, 4, 0, "----", "LD C,A", C, A) \
+    _X_(50, LD_R_R, 1, 4, 0, "----", "LD D,B", D, B) \
+    _X_(51, LD_R_R, 1, 4, 0, "----", "LD D,C", D, C) \
+    _X_(52, LD_R_R, 1, 4, 0, "----", "LD D,D", D, D) \
+    _X_(53, LD_R_R, 1, 4, 0, "----", "LD D,E", D, E) \
+    _X_(54, LD_R_R, 1, 4, 0, "----", "LD D,H", D, H) \
+    _X_(55, LD_R_R, 1, 4, 0, "----", "LD D,L", D, L) \
+    _X_(56, LD_R_HL, 1, 8, 0, "----", "LD D,(HL)", D) \
+    _X_(57, LD_R_R, 1, 4, 0, "----", "LD D,A", D, A) \
+    _X_(58, LD_R_R, 1, 4, 0, "----", "LD E,B", E, B) \
+    _X_(59, LD_R_R, 1, 4, 0, "----", "LD E,C", E, C) \
+    _X_(5A, LD_R_R, 1, 4, 0, "----", "LD E,D", E, D) \
+    _X_(5B, LD_R_R, 1, 4, 0, "----", "LD E,E", E, E) \
+    _X_(5C, LD_R_R, 1, 4, 0, "----", "LD E,H", E, H) \
+    _X_(5D, LD_R_R, 1, 4, 0, "----", "LD E,L", E, L) \
+    _X_(5E, LD_R_HL, 1, 8, 0, "----", "LD E,(HL)", E) \
+    _X_(5F, LD_R_R, 1, 4, 0, "----", "LD E,A", E, A) \
+    _X_(60, LD_R_R, 1, 4, 0, "----", "LD H,B", H, B) \
+    _X_(61, LD_R_R, 1, 4, 0, "----", "LD H,C", H, C) \
+    _X_(62, LD_R_R, 1, 4, 0, "----", "LD H,D", H, D) \
+    _X_(63, LD_R_R, 1, 4, 0, "----", "LD H,E", H, E) \
+    _X_(64, LD_R_R, 1, 4, 0, "----", "LD H,H", H, H) \
+    _X_(65, LD_R_R, 1, 4, 0, "----", "LD H,L", H, L) \
+    _X_(66, LD_R_HL, 1, 8, 0, "----", "LD H,(HL)", H) \
+    _X_(67, LD_R_R, 1, 4, 0, "----", "LD H,A", H, A) \
+    _X_(68, LD_R_R, 1, 4, 0, "----", "LD L,B", L, B) \
+    _X_(69, LD_R_R, 1, 4, 0, "----", "LD L,C", L, C) \
+    _X_(6A, LD_R_R, 1, 4, 0, "----", "LD L,D", L, D) \
+    _X_(6B, LD_R_R, 1, 4, 0, "----", "LD L,E", L, E) \
+    _X_(6C, LD_R_R, 1, 4, 0, "----", "LD L,H", L, H) \
+    _X_(6D, LD_R_R, 1, 4, 0, "----", "LD L,L", L, L) \
+    _X_(6E, LD_R_HL, 1, 8, 0, "----", "LD L,(HL)", L) \
+    _X_(6F, LD_R_R, 1, 4, 0, "----", "LD L,A", L, A) \
+    _X_(70, LD_HL_R, 1, 8, 0, "----", "LD (HL),B", B) \
+    _X_(71, LD_HL_R, 1, 8, 0, "----", "LD (HL),C", C) \
+    _X_(72, LD_HL_R, 1, 8, 0, "----", "LD (HL),D", D) \
+    _X_(73, LD_HL_R, 1, 8, 0, "----", "LD (HL),E", E) \
+    _X_(74, LD_HL_R, 1, 8, 0, "----", "LD (HL),H", H) \
+    _X_(75, LD_HL_R, 1, 8, 0, "----", "LD (HL),L", L) \
+    _X_(76, HALT, 1, 4, 4, "----", "HALT") \
+    _X_(77, LD_HL_R, 1, 8, 0, "----", "LD (HL),A", A) \
+    _X_(78, LD_R_R, 1, 4, 0, "----", "LD A,B", A, B) \
+    _X_(79, LD_R_R, 1, 4, 0, "----", "LD A,C", A, C) \
+    _X_(7A, LD_R_R, 1, 4, 0, "----", "LD A,D", A, D) \
+    _X_(7B, LD_R_R, 1, 4, 0, "----", "LD A,E", A, E) \
+    _X_(7C, LD_R_R, 1, 4, 0, "----", "LD A,H", A, H) \
+    _X_(7D, LD_R_R, 1, 4, 0, "----", "LD A,L", A, L) \
+    _X_(7E, LD_R_HL, 1, 8, 0, "----", "LD A,(HL)", A) \
+    _X_(7F, LD_R_R, 1, 4, 0, "----", "LD A,A", A, A) \
+    _X_(80, ALU_R, 1, 4, 0, "Z0HC", "ADD A,B", add, B) \
+    _X_(81, ALU_R, 1, 4, 0, "Z0HC", "ADD A,C", add, C) \
+    _X_(82, ALU_R, 1, 4, 0, "Z0HC", "ADD A,D", add, D) \
+    _X_(83, ALU_R, 1, 4, 0, "Z0HC", "ADD A,E", add, E) \
+    _X_(84, ALU_R, 1, 4, 0, "Z0HC", "ADD A,H", add, H) \
+    _X_(85, ALU_R, 1, 4, 0, "Z0HC", "ADD A,L", add, L) \
+    _X_(86, ALU_HL, 1, 8, 0, "Z0HC", "ADD A,(HL)", add) \
+    _X_(87, ALU_R, 1, 4, 0, "Z0HC", "ADD A,A", add, A) \
+    _X_(88, ALU_R, 1, 4, 0, "Z0HC", "ADC A,B", adc, B) \
+    _X_(89, ALU_R, 1, 4, 0, "Z0HC", "ADC A,C", adc, C) \
+    _X_(8A, ALU_R, 1, 4, 0, "Z0HC", "ADC A,D", adc, D) \
+    _X_(8B, ALU_R, 1, 4, 0, "Z0HC", "ADC A,E", adc, E) \
+    _X_(8C, ALU_R, 1, 4, 0, "Z0HC", "ADC A,H", adc, H) \
+    _X_(8D, ALU_R, 1, 4, 0, "Z0HC", "ADC A,L", adc, L) \
+    _X_(8E, ALU_HL, 1, 8, 0, "Z0HC", "ADC A,(HL)", adc) \
+    _X_(8F, ALU_R, 1, 4, 0, "Z0HC", "ADC A,A", adc, A) \
+    _X_(90, ALU_R, 1, 4, 0, "Z1HC", "SUB B", sub, B) \
+    _X_(91, ALU_R, 1, 4, 0, "Z1HC", "SUB C", sub, C) \
+    _X_(92, ALU_R, 1, 4, 0, "Z1HC", "SUB D", sub, D) \
+    _X_(93, ALU_R, 1, 4, 0, "Z1HC", "SUB E", sub, E) \
+    _X_(94, ALU_R, 1, 4, 0, "Z1HC", "SUB H", sub, H) \
+    _X_(95, ALU_R, 1, 4, 0, "Z1HC", "SUB L", sub, L) \
+    _X_(96, ALU_HL, 1, 8, 0, "Z1HC", "SUB (HL)", sub) \
+    _X_(97, ALU_R, 1, 4, 0, "Z1HC", "SUB A", sub, A) \
+    _X_(98, ALU_R, 1, 4, 0, "Z1HC", "SBC A,B", sbc, B) \
+    _X_(99, ALU_R, 1, 4, 0, "Z1HC", "SBC A,C", sbc, C) \
+    _X_(9A, ALU_R, 1, 4, 0, "Z1HC", "SBC A,D", sbc, D) \
+    _X_(9B, ALU_R, 1, 4, 0, "Z1HC", "SBC A,E", sbc, E) \
+    _X_(9C, ALU_R, 1, 4, 0, "Z1HC", "SBC A,H", sbc, H) \
+    _X_(9D, ALU_R, 1, 4, 0, "Z1HC", "SBC A,L", sbc, L) \
+    _X_(9E, ALU_HL, 1, 8, 0, "Z1HC", "SBC A,(HL)", sbc) \
+    _X_(9F, ALU_R, 1, 4, 0, "Z1HC", "SBC A,A", sbc, A) \
+    _X_(A0, ALU_R, 1, 4, 0, "Z010", "AND B", and, B) \
+    _X_(A1, ALU_R, 1, 4, 0, "Z010", "AND C", and, C) \
+    _X_(A2, ALU_R, 1, 4, 0, "Z010", "AND D", and, D) \
+    _X_(A3, ALU_R, 1, 4, 0, "Z010", "AND E", and, E) \
+    _X_(A4, ALU_R, 1, 4, 0, "Z010", "AND H", and, H) \
+    _X_(A5, ALU_R, 1, 4, 0, "Z010", "AND L", and, L) \
+    _X_(A6, ALU_HL, 1, 8, 0, "Z010", "AND (HL)", and) \
+    _X_(A7, ALU_R, 1, 4, 0, "Z010", "AND A", and, A) \
+    _X_(A8, ALU_R, 1, 4, 0, "Z000", "XOR B", xor, B) \
+    _X_(A9, ALU_R, 1, 4, 0, "Z000", "XOR C", xor, C) \
+    _X_(AA, ALU_R, 1, 4, 0, "Z000", "XOR D", xor, D) \
+    _X_(AB, ALU_R, 1, 4, 0, "Z000", "XOR E", xor, E) \
+    _X_(AC, ALU_R, 1, 4, 0, "Z000", "XOR H", xor, H) \
+    _X_(AD, ALU_R, 1, 4, 0, "Z000", "XOR L", xor, L) \
+    _X_(AE, ALU_HL, 1, 8, 0, "Z000", "XOR (HL)", xor) \
+    _X_(AF, ALU_R, 1, 4, 0, "Z000", "XOR A", xor, A) \
+    _X_(B0, ALU_R, 1, 4, 0, "Z000", "OR B", or, B) \
+    _X_(B1, ALU_R, 1, 4, 0, "Z000", "OR C", or, C) \
+    _X_(B2, ALU_R, 1, 4, 0, "Z000", "OR D", or, D) \
+    _X_(B3, ALU_R, 1, 4, 0, "Z000", "OR E", or, E) \
+    _X_(B4, ALU_R, 1, 4, 0, "Z000", "OR H", or, H) \
+    _X_(B5, ALU_R, 1, 4, 0, "Z000", "OR L", or, L) \
+    _X_(B6, ALU_HL, 1, 8, 0, "Z000", "OR (HL)", or) \
+    _X_(B7, ALU_R, 1, 4, 0, "Z000", "OR A", or, A) \
+    _X_(B8, ALU_R, 1, 4, 0, "Z1HC", "CP B", cp, B) \
+    _X_(B9, ALU_R, 1, 4, 0, "Z1HC", "CP C", cp, C) \
+    _X_(BA, ALU_R, 1, 4, 0, "Z1HC", "CP D", cp, D) \
+    _X_(BB, ALU_R, 1, 4, 0, "Z1HC", "CP E", cp, E) \
+    _X_(BC, ALU_R, 1, 4, 0, "Z1HC", "CP H", cp, H) \
+    _X_(BD, ALU_R, 1, 4, 0, "Z1HC", "CP L", cp, L) \
+    _X_(BE, ALU_HL, 1, 8, 0, "Z1HC", "CP (HL)", cp) \
+    _X_(BF, ALU_R, 1, 4, 0, "Z1HC", "CP A", cp, A) \
+    _X_(C0, RET, 1, 8, 20, "----", "RET NZ", NZ) \
+    _X_(C1, POP, 1, 12, 0, "----", "POP BC", BC) \
+    _X_(C2, JP, 3, 12, 16, "----", "JP NZ,a16", NZ) \
+    _X_(C3, JP, 3, 12, 16, "----", "JP a16", N) \
+    _X_(C4, CALL, 3, 12, 24, "----", "CALL NZ,a16", NZ) \
+    _X_(C5, PUSH, 1, 16, 0, "----", "PUSH BC", BC) \
+    _X_(C6, ALU_N, 2, 8, 0, "Z0HC", "ADD A,n8", add) \
+    _X_(C7, RST, 1, 16, 16, "----", "RST $00", 0x00) \
+    _X_(C8, RET, 1, 8, 20, "----", "RET Z", Z) \
+    _X_(C9, RET, 1, 8, 16, "----", "RET", N) \
+    _X_(CA, JP, 3, 12, 16, "----", "JP Z,a16", Z) \
+    _X_(CB, INVALID, 1, 4, 4, "----", "PREFIX") \
+    _X_(CC, CALL, 3, 12, 24, "----", "CALL Z,a16", Z) \
+    _X_(CD, CALL, 3, 12, 24, "----", "CALL a16", N) \
+    _X_(CE, ALU_N, 2, 8, 0, "Z0HC", "ADC A,n8", adc) \
+    _X_(CF, RST, 1, 16, 16, "----", "RST $08", 0x08) \
+    _X_(D0, RET, 1, 8, 20, "----", "RET NC", NC) \
+    _X_(D1, POP, 1, 12, 0, "----", "POP DE", DE) \
+    _X_(D2, JP, 3, 12, 16, "----", "JP NC,a16", NC) \
+    _X_(D3, INVALID, 1, 4, 4, "----", "INVALID") \
+    _X_(D4, CALL, 3, 12, 24, "----", "CALL NC,a16", NC) \
+    _X_(D5, PUSH, 1, 16, 0, "----", "PUSH DE", DE) \
+    _X_(D6, ALU_N, 2, 8, 0, "Z1HC", "SUB n8", sub) \
+    _X_(D7, RST, 1, 16, 16, "----", "RST $10", 0x10) \
+    _X_(D8, RET, 1, 8, 20, "----", "RET C", C) \
+    _X_(D9, RETI, 1, 16, 16, "----", "RETI") \
+    _X_(DA, JP, 3, 12, 16, "----", "JP C,a16", C) \
+    _X_(DB, INVALID, 1, 4, 4, "----", "INVALID") \
+    _X_(DC, CALL, 3, 12, 24, "----", "CALL C,a16", C) \
+    _X_(DD, INVALID, 1, 4, 4, "----", "INVALID") \
+    _X_(DE, ALU_N, 2, 8, 0, "Z1HC", "SBC A,n8", sbc) \
+    _X_(DF, RST, 1, 16, 16, "----", "RST $18", 0x18) \
+    _X_(E0, LD_FFN_A, 2, 12, 0, "----", "LDH (a8),A") \
+    _X_(E1, POP, 1, 12, 0, "----", "POP HL", HL) \
+    _X_(E2, LD_FFC_A, 1, 8, 0, "----", "LDH (C),A") \
+    _X_(E3, INVALID, 1, 4, 4, "----", "INVALID") \
+    _X_(E4, INVALID, 1, 4, 4, "----", "INVALID") \
+    _X_(E5, PUSH, 1, 16, 0, "----", "PUSH HL", HL) \
+    _X_(E6, ALU_N, 2, 8, 0, "Z010", "AND n8", and) \
+    _X_(E7, RST, 1, 16, 16, "----", "RST $20", 0x20) \
+    _X_(E8, ADD_SP_N, 2, 16, 0, "00HC", "ADD SP,e8") \
+    _X_(E9, JP_HL, 1, 4, 4, "----", "JP HL") \
+    _X_(EA, LD_NN_A, 3, 16, 0, "----", "LD (a16),A") \
+    _X_(EB, INVALID, 1, 4, 4, "----", "INVALID") \
+    _X_(EC, INVALID, 1, 4, 4, "----", "INVALID") \
+    _X_(ED, INVALID, 1, 4, 4, "----", "INVALID") \
+    _X_(EE, ALU_N, 2, 8, 0, "Z000", "XOR n8", xor) \
+    _X_(EF, RST, 1, 16, 16, "----", "RST $28", 0x28) \
+    _X_(F0, LD_A_FFN, 2, 12, 0, "----", "LDH A,(a8)") \
+    _X_(F1, POP_AF, 1, 12, 0, "ZNHC", "POP AF") \
+    _X_(F2, LD_A_FFC, 1, 8, 0, "----", "LDH A,(C)") \
+    _X_(F3, DI, 1, 4, 0, "----", "DI") \
+    _X_(F4, INVALID, 1, 4, 4, "----", "INVALID") \
+    _X_(F5, PUSH_AF, 1, 16, 0, "----", "PUSH AF") \
+    _X_(F6, ALU_N, 2, 8, 0, "Z000", "OR n8", or) \
+    _X_(F7, RST, 1, 16, 16, "----", "RST $30", 0x30) \
+    _X_(F8, LD_HL_SPN, 2, 12, 0, "00HC", "LD HL,SP+e8") \
+    _X_(F9, LD_SP_HL, 1, 8, 0, "----", "LD SP,HL") \
+    _X_(FA, LD_A_NN, 3, 16, 0, "----", "LD A,(a16)") \
+    _X_(FB, EI, 1, 4, 0, "----", "EI") \
+    _X_(FC, INVALID, 1, 4, 4, "----", "INVALID") \
+    _X_(FD, INVALID, 1, 4, 4, "----", "INVALID") \
+    _X_(FE, ALU_N, 2, 8, 0, "Z1HC", "CP n8", cp) \
+    _X_(FF, RST, 1, 16, 16, "----", "RST $38", 0x38)
+
+/* CB OPCODE, TEMPLATE, LENGTH, CYCLES, BRANCH CYCLES, FLAGS (ZNHC), MNEMONIC, OPERANDS */
+#define DMG_PROCESSOR_INSTRUCTION_EXTENDED(_X_) \
+    _X_(00, MODIFY_R, 2, 8, 0, "Z00C", "RLC B", rlc, B) \
+    _X_(01, MODIFY_R, 2, 8, 0, "Z00C", "RLC C", rlc, C) \
+    _X_(02, MODIFY_R, 2, 8, 0, "Z00C", "RLC D", rlc, D) \
+    _X_(03, MODIFY_R, 2, 8, 0, "Z00C", "RLC E", rlc, E) \
+    _X_(04, MODIFY_R, 2, 8, 0, "Z00C", "RLC H", rlc, H) \
+    _X_(05, MODIFY_R, 2, 8, 0, "Z00C", "RLC L", rlc, L) \
+    _X_(06, MODIFY_HL, 2, 16, 0, "Z00C", "RLC (HL)", rlc) \
+    _X_(07, MODIFY_R, 2, 8, 0, "Z00C", "RLC A", rlc, A) \
+    _X_(08, MODIFY_R, 2, 8, 0, "Z00C", "RRC B", rrc, B) \
+    _X_(09, MODIFY_R, 2, 8, 0, "Z00C", "RRC C", rrc, C) \
+    _X_(0A, MODIFY_R, 2, 8, 0, "Z00C", "RRC D", rrc, D) \
+    _X_(0B, MODIFY_R, 2, 8, 0, "Z00C", "RRC E", rrc, E) \
+    _X_(0C, MODIFY_R, 2, 8, 0, "Z00C", "RRC H", rrc, H) \
+    _X_(0D, MODIFY_R, 2, 8, 0, "Z00C", "RRC L", rrc, L) \
+    _X_(0E, MODIFY_HL, 2, 16, 0, "Z00C", "RRC (HL)", rrc) \
+    _X_(0F, MODIFY_R, 2, 8, 0, "Z00C", "RRC A", rrc, A) \
+    _X_(10, MODIFY_R, 2, 8, 0, "Z00C", "RL B", rl, B) \
+    _X_(11, MODIFY_R, 2, 8, 0, "Z00C", "RL C", rl, C) \
+    _X_(12, MODIFY_R, 2, 8, 0, "Z00C", "RL D", rl, D) \
+    _X_(13, MODIFY_R, 2, 8, 0, "Z00C", "RL E", rl, E) \
+    _X_(14, MODIFY_R, 2, 8, 0, "Z00C", "RL H", rl, H) \
+    _X_(15, MODIFY_R, 2, 8, 0, "Z00C", "RL L", rl, L) \
+    _X_(16, MODIFY_HL, 2, 16, 0, "Z00C", "RL (HL)", rl) \
+    _X_(17, MODIFY_R, 2, 8, 0, "Z00C", "RL A", rl, A) \
+    _X_(18, MODIFY_R, 2, 8, 0, "Z00C", "RR B", rr, B) \
+    _X_(19, MODIFY_R, 2, 8, 0, "Z00C", "RR C", rr, C) \
+    _X_(1A, MODIFY_R, 2, 8, 0, "Z00C", "RR D", rr, D) \
+    _X_(1B, MODIFY_R, 2, 8, 0, "Z00C", "RR E", rr, E) \
+    _X_(1C, MODIFY_R, 2, 8, 0, "Z00C", "RR H", rr, H) \
+    _X_(1D, MODIFY_R, 2, 8, 0, "Z00C", "RR L", rr, L) \
+    _X_(1E, MODIFY_HL, 2, 16, 0, "Z00C", "RR (HL)", rr) \
+    _X_(1F, MODIFY_R, 2, 8, 0, "Z00C", "RR A", rr, A) \
+    _X_(20, MODIFY_R, 2, 8, 0, "Z00C", "SLA B", sla, B) \
+    _X_(21, MODIFY_R, 2, 8, 0, "Z00C", "SLA C", sla, C) \
+    _X_(22, MODIFY_R, 2, 8, 0, "Z00C", "SLA D", sla, D) \
+    _X_(23, MODIFY_R, 2, 8, 0, "Z00C", "SLA E", sla, E) \
+    _X_(24, MODIFY_R, 2, 8, 0, "Z00C", "SLA H", sla, H) \
+    _X_(25, MODIFY_R, 2, 8, 0, "Z00C", "SLA L", sla, L) \
+    _X_(26, MODIFY_HL, 2, 16, 0, "Z00C", "SLA (HL)", sla) \
+    _X_(27, MODIFY_R, 2, 8, 0, "Z00C", "SLA A", sla, A) \
+    _X_(28, MODIFY_R, 2, 8, 0, "Z00C", "SRA B", sra, B) \
+    _X_(29, MODIFY_R, 2, 8, 0, "Z00C", "SRA C", sra, C) \
+    _X_(2A, MODIFY_R, 2, 8, 0, "Z00C", "SRA D", sra, D) \
+    _X_(2B, MODIFY_R, 2, 8, 0, "Z00C", "SRA E", sra, E) \
+    _X_(2C, MODIFY_R, 2, 8, 0, "Z00C", "SRA H", sra, H) \
+    _X_(2D, MODIFY_R, 2, 8, 0, "Z00C", "SRA L", sra, L) \
+    _X_(2E, MODIFY_HL, 2, 16, 0, "Z00C", "SRA (HL)", sra) \
+    _X_(2F, MODIFY_R, 2, 8, 0, "Z00C", "SRA A", sra, A) \
+    _X_(30, MODIFY_R, 2, 8, 0, "Z000", "SWAP B", swap, B) \
+    _X_(31, MODIFY_R, 2, 8, 0, "Z000", "SWAP C", swap, C) \
+    _X_(32, MODIFY_R, 2, 8, 0, "Z000", "SWAP D", swap, D) \
+    _X_(33, MODIFY_R, 2, 8, 0, "Z000", "SWAP E", swap, E) \
+    _X_(34, MODIFY_R, 2, 8, 0, "Z000", "SWAP H", swap, H) \
+    _X_(35, MODIFY_R, 2, 8, 0, "Z000", "SWAP L", swap, L) \
+    _X_(36, MODIFY_HL, 2, 16, 0, "Z000", "SWAP (HL)", swap) \
+    _X_(37, MODIFY_R, 2, 8, 0, "Z000", "SWAP A", swap, A) \
+    _X_(38, MODIFY_R, 2, 8, 0, "Z00C", "SRL B", srl, B) \
+    _X_(39, MODIFY_R, 2, 8, 0, "Z00C", "SRL C", srl, C) \
+    _X_(3A, MODIFY_R, 2, 8, 0, "Z00C", "SRL D", srl, D) \
+    _X_(3B, MODIFY_R, 2, 8, 0, "Z00C", "SRL E", srl, E) \
+    _X_(3C, MODIFY_R, 2, 8, 0, "Z00C", "SRL H", srl, H) \
+    _X_(3D, MODIFY_R, 2, 8, 0, "Z00C", "SRL L", srl, L) \
+    _X_(3E, MODIFY_HL, 2, 16, 0, "Z00C", "SRL (HL)", srl) \
+    _X_(3F, MODIFY_R, 2, 8, 0, "Z00C", "SRL A", srl, A) \
+    _X_(40, BIT_R, 2, 8, 0, "Z01-", "BIT 0,B", 0, B) \
+    _X_(41, BIT_R, 2, 8, 0, "Z01-", "BIT 0,C", 0, C) \
+    _X_(42, BIT_R, 2, 8, 0, "Z01-", "BIT 0,D", 0, D) \
+    _X_(43, BIT_R, 2, 8, 0, "Z01-", "BIT 0,E", 0, E) \
+    _X_(44, BIT_R, 2, 8, 0, "Z01-", "BIT 0,H", 0, H) \
+    _X_(45, BIT_R, 2, 8, 0, "Z01-", "BIT 0,L", 0, L) \
+    _X_(46, BIT_HL, 2, 12, 0, "Z01-", "BIT 0,(HL)", 0) \
+    _X_(47, BIT_R, 2, 8, 0, "Z01-", "BIT 0,A", 0, A) \
+    _X_(48, BIT_R, 2, 8, 0, "Z01-", "BIT 1,B", 1, B) \
+    _X_(49, BIT_R, 2, 8, 0, "Z01-", "BIT 1,C", 1, C) \
+    _X_(4A, BIT_R, 2, 8, 0, "Z01-", "BIT 1,D", 1, D) \
+    _X_(4B, BIT_R, 2, 8, 0, "Z01-", "BIT 1,E", 1, E) \
+    _X_(4C, BIT_R, 2, 8, 0, "Z01-", "BIT 1,H", 1, H) \
+    _X_(4D, BIT_R, 2, 8, 0, "Z01-", "BIT 1,L", 1, L) \
+    _X_(4E, BIT_HL, 2, 12, 0, "Z01-", "BIT 1,(HL)", 1) \
+    _X_(4F, BIT_R, 2, 8, 0, "Z01-", "BIT 1,A", 1, A) \
+    _X_(50, BIT_R, 2, 8, 0, "Z01-", "BIT 2,B", 2, B) \
+    _X_(51, BIT_R, 2, 8, 0, "Z01-", "BIT 2,C", 2, C) \
+    _X_(52, BIT_R, 2, 8, 0, "Z01-", "BIT 2,D", 2, D) \
+    _X_(53, BIT_R, 2, 8, 0, "Z01-", "BIT 2,E", 2, E) \
+    _X_(54, BIT_R, 2, 8, 0, "Z01-", "BIT 2,H", 2, H) \
+    _X_(55, BIT_R, 2, 8, 0, "Z01-", "BIT 2,L", 2, L) \
+    _X_(56, BIT_HL, 2, 12, 0, "Z01-", "BIT 2,(HL)", 2) \
+    _X_(57, BIT_R, 2, 8, 0, "Z01-", "BIT 2,A", 2, A) \
+    _X_(58, BIT_R, 2, 8, 0, "Z01-", "BIT 3,B", 3, B) \
+    _X_(59, BIT_R, 2, 8, 0, "Z01-", "BIT 3,C", 3, C) \
+    _X_(5A, BIT_R, 2, 8, 0, "Z01-", "BIT 3,D", 3, D) \
+    _X_(5B, BIT_R, 2, 8, 0, "Z01-", "BIT 3,E", 3, E) \
+    _X_(5C, BIT_R, 2, 8, 0, "Z01-", "BIT 3,H", 3, H) \
+    _X_(5D, BIT_R, 2, 8, 0, "Z01-", "BIT 3,L", 3, L) \
+    _X_(5E, BIT_HL, 2, 12, 0, "Z01-", "BIT 3,(HL)", 3) \
+    _X_(5F, BIT_R, 2, 8, 0, "Z01-", "BIT 3,A", 3, A) \
+    _X_(60, BIT_R, 2, 8, 0, "Z01-", "BIT 4,B", 4, B) \
+    _X_(61, BIT_R, 2, 8, 0, "Z01-", "BIT 4,C", 4, C) \
+    _X_(62, BIT_R, 2, 8, 0, "Z01-", "BIT 4,D", 4, D) \
+    _X_(63, BIT_R, 2, 8, 0, "Z01-", "BIT 4,E", 4, E) \
+    _X_(64, BIT_R, 2, 8, 0, "Z01-", "BIT 4,H", 4, H) \
+    _X_(65, BIT_R, 2, 8, 0, "Z01-", "BIT 4,L", 4, L) \
+    _X_(66, BIT_HL, 2, 12, 0, "Z01-", "BIT 4,(HL)", 4) \
+    _X_(67, BIT_R, 2, 8, 0, "Z01-", "BIT 4,A", 4, A) \
+    _X_(68, BIT_R, 2, 8, 0, "Z01-", "BIT 5,B", 5, B) \
+    _X_(69, BIT_R, 2, 8, 0, "Z01-", "BIT 5,C", 5, C) \
+    _X_(6A, BIT_R, 2, 8, 0, "Z01-", "BIT 5,D", 5, D) \
+    _X_(6B, BIT_R, 2, 8, 0, "Z01-", "BIT 5,E", 5, E) \
+    _X_(6C, BIT_R, 2, 8, 0, "Z01-", "BIT 5,H", 5, H) \
+    _X_(6D, BIT_R, 2, 8, 0, "Z01-", "BIT 5,L", 5, L) \
+    _X_(6E, BIT_HL, 2, 12, 0, "Z01-", "BIT 5,(HL)", 5) \
+    _X_(6F, BIT_R, 2, 8, 0, "Z01-", "BIT 5,A", 5, A) \
+    _X_(70, BIT_R, 2, 8, 0, "Z01-", "BIT 6,B", 6, B) \
+    _X_(71, BIT_R, 2, 8, 0, "Z01-", "BIT 6,C", 6, C) \
+    _X_(72, BIT_R, 2, 8, 0, "Z01-", "BIT 6,D", 6, D) \
+    _X_(73, BIT_R, 2, 8, 0, "Z01-", "BIT 6,E", 6, E) \
+    _X_(74, BIT_R, 2, 8, 0, "Z01-", "BIT 6,H", 6, H) \
+    _X_(75, BIT_R, 2, 8, 0, "Z01-", "BIT 6,L", 6, L) \
+    _X_(76, BIT_HL, 2, 12, 0, "Z01-", "BIT 6,(HL)", 6) \
+    _X_(77, BIT_R, 2, 8, 0, "Z01-", "BIT 6,A", 6, A) \
+    _X_(78, BIT_R, 2, 8, 0, "Z01-", "BIT 7,B", 7, B) \
+    _X_(79, BIT_R, 2, 8, 0, "Z01-", "BIT 7,C", 7, C) \
+    _X_(7A, BIT_R, 2, 8, 0, "Z01-", "BIT 7,D", 7, D) \
+    _X_(7B, BIT_R, 2, 8, 0, "Z01-", "BIT 7,E", 7, E) \
+    _X_(7C, BIT_R, 2, 8, 0, "Z01-", "BIT 7,H", 7, H) \
+    _X_(7D, BIT_R, 2, 8, 0, "Z01-", "BIT 7,L", 7, L) \
+    _X_(7E, BIT_HL, 2, 12, 0, "Z01-", "BIT 7,(HL)", 7) \
+    _X_(7F, BIT_R, 2, 8, 0, "Z01-", "BIT 7,A", 7, A) \
+    _X_(80, RES_R, 2, 8, 0, "----", "RES 0,B", 0, B) \
+    _X_(81, RES_R, 2, 8, 0, "----", "RES 0,C", 0, C) \
+    _X_(82, RES_R, 2, 8, 0, "----", "RES 0,D", 0, D) \
+    _X_(83, RES_R, 2, 8, 0, "----", "RES 0,E", 0, E) \
+    _X_(84, RES_R, 2, 8, 0, "----", "RES 0,H", 0, H) \
+    _X_(85, RES_R, 2, 8, 0, "----", "RES 0,L", 0, L) \
+    _X_(86, RES_HL, 2, 16, 0, "----", "RES 0,(HL)", 0) \
+    _X_(87, RES_R, 2, 8, 0, "----", "RES 0,A", 0, A) \
+    _X_(88, RES_R, 2, 8, 0, "----", "RES 1,B", 1, B) \
+    _X_(89, RES_R, 2, 8, 0, "----", "RES 1,C", 1, C) \
+    _X_(8A, RES_R, 2, 8, 0, "----", "RES 1,D", 1, D) \
+    _X_(8B, RES_R, 2, 8, 0, "----", "RES 1,E", 1, E) \
+    _X_(8C, RES_R, 2, 8, 0, "----", "RES 1,H", 1, H) \
+    _X_(8D, RES_R, 2, 8, 0, "----", "RES 1,L", 1, L) \
+    _X_(8E, RES_HL, 2, 16, 0, "----", "RES 1,(HL)", 1) \
+    _X_(8F, RES_R, 2, 8, 0, "----", "RES 1,A", 1, A) \
+    _X_(90, RES_R, 2, 8, 0, "----", "RES 2,B", 2, B) \
+    _X_(91, RES_R, 2, 8, 0, "----", "RES 2,C", 2, C) \
+    _X_(92, RES_R, 2, 8, 0, "----", "RES 2,D", 2, D) \
+    _X_(93, RES_R, 2, 8, 0, "----", "RES 2,E", 2, E) \
+    _X_(94, RES_R, 2, 8, 0, "----", "RES 2,H", 2, H) \
+    _X_(95, RES_R, 2, 8, 0, "----", "RES 2,L", 2, L) \
+    _X_(96, RES_HL, 2, 16, 0, "----", "RES 2,(HL)", 2) \
+    _X_(97, RES_R, 2, 8, 0, "----", "RES 2,A", 2, A) \
+    _X_(98, RES_R, 2, 8, 0, "----", "RES 3,B", 3, B) \
+    _X_(99, RES_R, 2, 8, 0, "----", "RES 3,C", 3, C) \
+    _X_(9A, RES_R, 2, 8, 0, "----", "RES 3,D", 3, D) \
+    _X_(9B, RES_R, 2, 8, 0, "----", "RES 3,E", 3, E) \
+    _X_(9C, RES_R, 2, 8, 0, "----", "RES 3,H", 3, H) \
+    _X_(9D, RES_R, 2, 8, 0, "----", "RES 3,L", 3, L) \
+    _X_(9E, RES_HL, 2, 16, 0, "----", "RES 3,(HL)", 3) \
+    _X_(9F, RES_R, 2, 8, 0, "----", "RES 3,A", 3, A) \
+    _X_(A0, RES_R, 2, 8, 0, "----", "RES 4,B", 4, B) \
+    _X_(A1, RES_R, 2, 8, 0, "----", "RES 4,C", 4, C) \
+    _X_(A2, RES_R, 2, 8, 0, "----", "RES 4,D", 4, D) \
+    _X_(A3, RES_R, 2, 8, 0, "----", "RES 4,E", 4, E) \
+    _X_(A4, RES_R, 2, 8, 0, "----", "RES 4,H", 4, H) \
+    _X_(A5, RES_R, 2, 8, 0, "----", "RES 4,L", 4, L) \
+    _X_(A6, RES_HL, 2, 16, 0, "----", "RES 4,(HL)", 4) \
+    _X_(A7, RES_R, 2, 8, 0, "----", "RES 4,A", 4, A) \
+    _X_(A8, RES_R, 2, 8, 0, "----", "RES 5,B", 5, B) \
+    _X_(A9, RES_R, 2, 8, 0, "----", "RES 5,C", 5, C) \
+    _X_(AA, RES_R, 2, 8, 0, "----", "RES 5,D", 5, D) \
+    _X_(AB, RES_R, 2, 8, 0, "----", "RES 5,E", 5, E) \
+    _X_(AC, RES_R, 2, 8, 0, "----", "RES 5,H", 5, H) \
+    _X_(AD, RES_R, 2, 8, 0, "----", "RES 5,L", 5, L) \
+    _X_(AE, RES_HL, 2, 16, 0, "----", "RES 5,(HL)", 5) \
+    _X_(AF, RES_R, 2, 8, 0, "----", "RES 5,A", 5, A) \
+    _X_(B0, RES_R, 2, 8, 0, "----", "RES 6,B", 6, B) \
+    _X_(B1, RES_R, 2, 8, 0, "----", "RES 6,C", 6, C) \
+    _X_(B2, RES_R, 2, 8, 0, "----", "RES 6,D", 6, D) \
+    _X_(B3, RES_R, 2, 8, 0, "----", "RES 6,E", 6, E) \
+    _X_(B4, RES_R, 2, 8, 0, "----", "RES 6,H", 6, H) \
+    _X_(B5, RES_R, 2, 8, 0, "----", "RES 6,L", 6, L) \
+    _X_(B6, RES_HL, 2, 16, 0, "----", "RES 6,(HL)", 6) \
+    _X_(B7, RES_R, 2, 8, 0, "----", "RES 6,A", 6, A) \
+    _X_(B8, RES_R, 2, 8, 0, "----", "RES 7,B", 7, B) \
+    _X_(B9, RES_R, 2, 8, 0, "----", "RES 7,C", 7, C) \
+    _X_(BA, RES_R, 2, 8, 0, "----", "RES 7,D", 7, D) \
+    _X_(BB, RES_R, 2, 8, 0, "----", "RES 7,E", 7, E) \
+    _X_(BC, RES_R, 2, 8, 0, "----", "RES 7,H", 7, H) \
+    _X_(BD, RES_R, 2, 8, 0, "----", "RES 7,L", 7, L) \
+    _X_(BE, RES_HL, 2, 16, 0, "----", "RES 7,(HL)", 7) \
+    _X_(BF, RES_R, 2, 8, 0, "----", "RES 7,A", 7, A) \
+    _X_(C0, SET_R, 2, 8, 0, "----", "SET 0,B", 0, B) \
+    _X_(C1, SET_R, 2, 8, 0, "----", "SET 0,C", 0, C) \
+    _X_(C2, SET_R, 2, 8, 0, "----", "SET 0,D", 0, D) \
+    _X_(C3, SET_R, 2, 8, 0, "----", "SET 0,E", 0, E) \
+    _X_(C4, SET_R, 2, 8, 0, "----", "SET 0,H", 0, H) \
+    _X_(C5, SET_R, 2, 8, 0, "----", "SET 0,L", 0, L) \
+    _X_(C6, SET_HL, 2, 16, 0, "----", "SET 0,(HL)", 0) \
+    _X_(C7, SET_R, 2, 8, 0, "----", "SET 0,A", 0, A) \
+    _X_(C8, SET_R, 2, 8, 0, "----", "SET 1,B", 1, B) \
+    _X_(C9, SET_R, 2, 8, 0, "----", "SET 1,C", 1, C) \
+    _X_(CA, SET_R, 2, 8, 0, "----", "SET 1,D", 1, D) \
+    _X_(CB, SET_R, 2, 8, 0, "----", "SET 1,E", 1, E) \
+    _X_(CC, SET_R, 2, 8, 0, "----", "SET 1,H", 1, H) \
+    _X_(CD, SET_R, 2, 8, 0, "----", "SET 1,L", 1, L) \
+    _X_(CE, SET_HL, 2, 16, 0, "----", "SET 1,(HL)", 1) \
+    _X_(CF, SET_R, 2, 8, 0, "----", "SET 1,A", 1, A) \
+    _X_(D0, SET_R, 2, 8, 0, "----", "SET 2,B", 2, B) \
+    _X_(D1, SET_R, 2, 8, 0, "----", "SET 2,C", 2, C) \
+    _X_(D2, SET_R, 2, 8, 0, "----", "SET 2,D", 2, D) \
+    _X_(D3, SET_R, 2, 8, 0, "----", "SET 2,E", 2, E) \
+    _X_(D4, SET_R, 2, 8, 0, "----", "SET 2,H", 2, H) \
+    _X_(D5, SET_R, 2, 8, 0, "----", "SET 2,L", 2, L) \
+    _X_(D6, SET_HL, 2, 16, 0, "----", "SET 2,(HL)", 2) \
+    _X_(D7, SET_R, 2, 8, 0, "----", "SET 2,A", 2, A) \
+    _X_(D8, SET_R, 2, 8, 0, "----", "SET 3,B", 3, B) \
+    _X_(D9, SET_R, 2, 8, 0, "----", "SET 3,C", 3, C) \
+    _X_(DA, SET_R, 2, 8, 0, "----", "SET 3,D", 3, D) \
+    _X_(DB, SET_R, 2, 8, 0, "----", "SET 3,E", 3, E) \
+    _X_(DC, SET_R, 2, 8, 0, "----", "SET 3,H", 3, H) \
+    _X_(DD, SET_R, 2, 8, 0, "----", "SET 3,L", 3, L) \
+    _X_(DE, SET_HL, 2, 16, 0, "----", "SET 3,(HL)", 3) \
+    _X_(DF, SET_R, 2, 8, 0, "----", "SET 3,A", 3, A) \
+    _X_(E0, SET_R, 2, 8, 0, "----", "SET 4,B", 4, B) \
+    _X_(E1, SET_R, 2, 8, 0, "----", "SET 4,C", 4, C) \
+    _X_(E2, SET_R, 2, 8, 0, "----", "SET 4,D", 4, D) \
+    _X_(E3, SET_R, 2, 8, 0, "----", "SET 4,E", 4, E) \
+    _X_(E4, SET_R, 2, 8, 0, "----", "SET 4,H", 4, H) \
+    _X_(E5, SET_R, 2, 8, 0, "----", "SET 4,L", 4, L) \
+    _X_(E6, SET_HL, 2, 16, 0, "----", "SET 4,(HL)", 4) \
+    _X_(E7, SET_R, 2, 8, 0, "----", "SET 4,A", 4, A) \
+    _X_(E8, SET_R, 2, 8, 0, "----", "SET 5,B", 5, B) \
+    _X_(E9, SET_R, 2, 8, 0, "----", "SET 5,C", 5, C) \
+    _X_(EA, SET_R, 2, 8, 0, "----", "SET 5,D", 5, D) \
+    _X_(EB, SET_R, 2, 8, 0, "----", "SET 5,E", 5, E) \
+    _X_(EC, SET_R, 2, 8, 0, "----", "SET 5,H", 5, H) \
+    _X_(ED, SET_R, 2, 8, 0, "----", "SET 5,L", 5, L) \
+    _X_(EE, SET_HL, 2, 16, 0, "----", "SET 5,(HL)", 5) \
+    _X_(EF, SET_R, 2, 8, 0, "----", "SET 5,A", 5, A) \
+    _X_(F0, SET_R, 2, 8, 0, "----", "SET 6,B", 6, B) \
+    _X_(F1, SET_R, 2, 8, 0, "----", "SET 6,C", 6, C) \
+    _X_(F2, SET_R, 2, 8, 0, "----", "SET 6,D", 6, D) \
+    _X_(F3, SET_R, 2, 8, 0, "----", "SET 6,E", 6, E) \
+    _X_(F4, SET_R, 2, 8, 0, "----", "SET 6,H", 6, H) \
+    _X_(F5, SET_R, 2, 8, 0, "----", "SET 6,L", 6, L) \
+    _X_(F6, SET_HL, 2, 16, 0, "----", "SET 6,(HL)", 6) \
+    _X_(F7, SET_R, 2, 8, 0, "----", "SET 6,A", 6, A) \
+    _X_(F8, SET_R, 2, 8, 0, "----", "SET 7,B", 7, B) \
+    _X_(F9, SET_R, 2, 8, 0, "----", "SET 7,C", 7, C) \
+    _X_(FA, SET_R, 2, 8, 0, "----", "SET 7,D", 7, D) \
+    _X_(FB, SET_R, 2, 8, 0, "----", "SET 7,E", 7, E) \
+    _X_(FC, SET_R, 2, 8, 0, "----", "SET 7,H", 7, H) \
+    _X_(FD, SET_R, 2, 8, 0, "----", "SET 7,L", 7, L) \
+    _X_(FE, SET_HL, 2, 16, 0, "----", "SET 7,(HL)", 7) \
+    _X_(FF, SET_R, 2, 8, 0, "----", "SET 7,A", 7, A)
+
+#define DMG_OPCODE_ENTRY(_OPCODE_, _TEMPLATE_, _LENGTH_, _CYCLES_, _BRANCH_, _FLAGS_, _MNEMONIC_, ...) \
+    [0x##_OPCODE_] = { _MNEMONIC_, _FLAGS_, _LENGTH_, _CYCLES_, _BRANCH_ },
+#define DMG_OPCODE_EXTENDED_ENTRY(_OPCODE_, _TEMPLATE_, _LENGTH_, _CYCLES_, _BRANCH_, _FLAGS_, _MNEMONIC_, ...) \
+    [256 + 0x##_OPCODE_] = { _MNEMONIC_, _FLAGS_, _LENGTH_, _CYCLES_, _BRANCH_ },
+
+static const dmg_opcode_t OPCODE[] =
+{
+    DMG_PROCESSOR_INSTRUCTION(DMG_OPCODE_ENTRY)
+    DMG_PROCESSOR_INSTRUCTION_EXTENDED(DMG_OPCODE_EXTENDED_ENTRY)
+};
+
+static bool dmg_processor_carry(dmg_t const dmg)
+{
+    bool result;
+    switch (dmg->processor.flag.operation)
     {
-        case 0x88: /* B */
-            operand = dmg->processor.bc.high;
-            break;
-        case 0x89: /* C */
-            operand = dmg->processor.bc.low;
-            break;
-        case 0x8A: /* D */
-            operand = dmg->processor.de.high;
-            break;
-        case 0x8B: /* E */
-            operand = dmg->processor.de.low;
-            break;
-        case 0x8C: /* H */
-            operand = dmg->processor.hl.high;
+        case DMG_FLAG_ADD:
+        case DMG_FLAG_ROTATE:
+        case DMG_FLAG_SHIFT:
+        case DMG_FLAG_SUB:
+            result = ((dmg->processor.flag.result & 0x100) == 0x100);
             break;
-        case 0x8D: /* L */
-            operand = dmg->processor.hl.low;
+        case DMG_FLAG_AND:
+        case DMG_FLAG_LOGIC:
+            result = false;
             break;
-        case 0x8E: /* (HL) */
-            dmg->processor.delay += 4;
-            operand = dmg_system_read(dmg, dmg->processor.hl.word);
+        case DMG_FLAG_BIT:
+        case DMG_FLAG_DEC:
+        case DMG_FLAG_INC:
+            result = dmg->processor.flag.carry;
             break;
-        case 0x8F: /* A */
-            operand = dmg->processor.af.high;
-            break;
-        case 0xCE: /* # */
-            dmg->processor.delay += 4;
-            operand = dmg_system_read(dmg, dmg->processor.pc.word++);
+        default:
+            result = dmg->processor.af.carry;
             break;
     }
-    carry = dmg->processor.af.carry;
-    sum = dmg->processor.af.high + operand + carry;
-    dmg->processor.af.carry = (sum > 0xFF);
-    dmg->processor.af.half_carry = (((dmg->processor.af.high & 0x0F) + (operand & 0x0F) + carry) > 0x0F);
-    dmg->processor.af.negative = false;
-    dmg->processor.af.zero = !(sum & 0xFF);
-    dmg->processor.af.high = sum;
+    return result;
 }
 
-static void dmg_processor_instruction_add(dmg_t const dmg)
+static bool dmg_processor_zero(dmg_t const dmg)
 {
-    uint8_t operand = 0;
-    uint16_t carry, sum;
-    dmg->processor.delay = 4;
-    switch (dmg->processor.instruction.opcode)
+    bool result;
+    switch (dmg->processor.flag.operation)
     {
-        case 0x80: /* B */
-            operand = dmg->processor.bc.high;
+        case DMG_FLAG_NONE:
+            result = dmg->processor.af.zero;
             break;
-        case 0x81: /* C */
-            operand = dmg->processor.bc.low;
+        case DMG_FLAG_ROTATE:
+            result = false;
             break;
-        case 0x82: /* D */
-            operand = dmg->processor.de.high;
+        default:
+            result = !(dmg->processor.flag.result & 0xFF);
             break;
-        case 0x83: /* E */
-            operand = dmg->processor.de.low;
+    }
+    return result;
+}
+
+#if defined(DMG_ALU_ARITHMETIC) || defined(DMG_ALU_VERIFY)
+static void dmg_processor_flags_arithmetic(dmg_t const dmg)
+{
+    switch (dmg->processor.flag.operation)
+    {
+        case DMG_FLAG_ADD:
+            dmg->processor.af.half_carry = (((dmg->processor.flag.operand ^ dmg->processor.flag.result) & 0x10) == 0x10);
+            dmg->processor.af.negative = false;
             break;
-        case 0x84: /* H */
-            operand = dmg->processor.hl.high;
+        case DMG_FLAG_AND:
+        case DMG_FLAG_BIT:
+            dmg->processor.af.half_carry = true;
+            dmg->processor.af.negative = false;
             break;
-        case 0x85: /* L */
-            operand = dmg->processor.hl.low;
+        case DMG_FLAG_DEC:
+            dmg->processor.af.half_carry = ((dmg->processor.flag.result & 0x0F) == 0x0F);
+            dmg->processor.af.negative = true;
             break;
-        case 0x86: /* (HL) */
-            dmg->processor.delay += 4;
-            operand = dmg_system_read(dmg, dmg->processor.hl.word);
+        case DMG_FLAG_INC:
+            dmg->processor.af.half_carry = !(dmg->processor.flag.result & 0x0F);
+            dmg->processor.af.negative = false;
             break;
-        case 0x87: /* A */
-            operand = dmg->processor.af.high;
+        case DMG_FLAG_SUB:
+            dmg->processor.af.half_carry = (((dmg->processor.flag.operand ^ dmg->processor.flag.result) & 0x10) == 0x10);
+            dmg->processor.af.negative = true;
             break;
-        case 0xC6: /* # */
-            dmg->processor.delay += 4;
-            operand = dmg_system_read(dmg, dmg->processor.pc.word++);
+        default:
+            dmg->processor.af.half_carry = false;
+            dmg->processor.af.negative = false;
             break;
     }
+}
+#endif /* DMG_ALU_ARITHMETIC || DMG_ALU_VERIFY */
+
+static void dmg_processor_flags(dmg_t const dmg)
+{
+    if (dmg->processor.flag.operation != DMG_FLAG_NONE)
+    {
+#ifndef DMG_ALU_ARITHMETIC
+        dmg->processor.af.low = (dmg_processor_zero(dmg) << 7) | (dmg_processor_carry(dmg) << 4) | dmg->processor.table.flag[(dmg->processor.flag.operation << 5) | ((dmg->processor.flag.operand ^ dmg->processor.flag.result) & 0x10) | (dmg->processor.flag.result & 0x0F)];
+#else
+        dmg->processor.af.carry = dmg_processor_carry(dmg);
+        dmg->processor.af.zero = dmg_processor_zero(dmg);
+        dmg_processor_flags_arithmetic(dmg);
+#endif /* DMG_ALU_ARITHMETIC */
+        dmg->processor.flag.operation = DMG_FLAG_NONE;
+    }
+}
+
+static void dmg_processor_adc(dmg_t const dmg, uint8_t operand)
+{
+    uint16_t sum;
+    sum = dmg->processor.af.high + operand + dmg_processor_carry(dmg);
+    dmg->processor.flag.operation = DMG_FLAG_ADD;
+    dmg->processor.flag.operand = dmg->processor.af.high ^ operand;
+    dmg->processor.flag.result = sum;
+    dmg->processor.af.high = sum;
+}
+
+static void dmg_processor_add(dmg_t const dmg, uint8_t operand)
+{
+    uint16_t sum;
     sum = dmg->processor.af.high + operand;
-    carry = dmg->processor.af.high ^ operand ^ sum;
-    dmg->processor.af.carry = ((carry & 0x100) == 0x100);
-    dmg->processor.af.half_carry = ((carry & 0x10) == 0x10);
-    dmg->processor.af.negative = false;
-    dmg->processor.af.zero = !(sum & 0xFF);
+    dmg->processor.flag.operation = DMG_FLAG_ADD;
+    dmg->processor.flag.operand = dmg->processor.af.high ^ operand;
+    dmg->processor.flag.result = sum;
     dmg->processor.af.high = sum;
 }
 
-static void dmg_processor_instruction_add_hl(dmg_t const dmg)
+static void dmg_processor_add_hl(dmg_t const dmg, uint16_t operand)
 {
     uint32_t carry, sum;
-    uint16_t operand = 0;
-    dmg->processor.delay = 8;
-    switch (dmg->processor.instruction.opcode)
-    {
-        case 0x09: /* BC */
-            operand = dmg->processor.bc.word;
-            break;
-        case 0x19: /* DE */
-            operand = dmg->processor.de.word;
-            break;
-        case 0x29: /* HL */
-            operand = dmg->processor.hl.word;
-            break;
-        case 0x39: /* SP */
-            operand = dmg->processor.sp.word;
-            break;
-    }
+    dmg_processor_flags(dmg);
     sum = dmg->processor.hl.word + operand;
     carry = dmg->processor.hl.word ^ operand ^ sum;
     dmg->processor.af.carry = ((carry & 0x10000) == 0x10000);
@@ -127,198 +894,43 @@ static void dmg_processor_instruction_add_hl(dmg_t const dmg)
     dmg->processor.hl.word = sum;
 }
 
-static void dmg_processor_instruction_add_sp(dmg_t const dmg)
+static uint16_t dmg_processor_add_sp(dmg_t const dmg, int8_t operand)
 {
     uint32_t carry, sum;
-    int8_t operand = dmg_system_read(dmg, dmg->processor.pc.word++);
-    dmg->processor.delay = 16;
     sum = dmg->processor.sp.word + operand;
     carry = dmg->processor.sp.word ^ operand ^ sum;
+    dmg->processor.flag.operation = DMG_FLAG_NONE;
     dmg->processor.af.carry = ((carry & 0x100) == 0x100);
     dmg->processor.af.half_carry = ((carry & 0x10) == 0x10);
     dmg->processor.af.negative = false;
     dmg->processor.af.zero = false;
-    dmg->processor.sp.word = sum;
-}
-
-static void dmg_processor_instruction_and(dmg_t const dmg)
-{
-    dmg->processor.delay = 4;
-    switch (dmg->processor.instruction.opcode)
-    {
-        case 0xA0: /* B */
-            dmg->processor.af.high &= dmg->processor.bc.high;
-            break;
-        case 0xA1: /* C */
-            dmg->processor.af.high &= dmg->processor.bc.low;
-            break;
-        case 0xA2: /* D */
-            dmg->processor.af.high &= dmg->processor.de.high;
-            break;
-        case 0xA3: /* E */
-            dmg->processor.af.high &= dmg->processor.de.low;
-            break;
-        case 0xA4: /* H */
-            dmg->processor.af.high &= dmg->processor.hl.high;
-            break;
-        case 0xA5: /* L */
-            dmg->processor.af.high &= dmg->processor.hl.low;
-            break;
-        case 0xA6: /* (HL) */
-            dmg->processor.delay += 4;
-            dmg->processor.af.high &= dmg_system_read(dmg, dmg->processor.hl.word);
-            break;
-        case 0xA7: /* A */
-            break;
-        case 0xE6: /* # */
-            dmg->processor.delay += 4;
-            dmg->processor.af.high &= dmg_system_read(dmg, dmg->processor.pc.word++);
-            break;
-    }
-    dmg->processor.af.carry = false;
-    dmg->processor.af.half_carry = true;
-    dmg->processor.af.negative = false;
-    dmg->processor.af.zero = !dmg->processor.af.high;
-}
-
-static void dmg_processor_instruction_bit(dmg_t const dmg)
-{
-    dmg->processor.delay = 8;
-    switch (dmg->processor.instruction.opcode)
-    {
-        case 0x40: case 0x48: case 0x50: case 0x58:
-        case 0x60: case 0x68: case 0x70: case 0x78: /* B */
-            dmg->processor.af.zero = !(dmg->processor.bc.high & (1 << ((dmg->processor.instruction.opcode - 0x40) / 8)));
-            break;
-        case 0x41: case 0x49: case 0x51: case 0x59:
-        case 0x61: case 0x69: case 0x71: case 0x79: /* C */
-            dmg->processor.af.zero = !(dmg->processor.bc.low & (1 << ((dmg->processor.instruction.opcode - 0x41) / 8)));
-            break;
-        case 0x42: case 0x4A: case 0x52: case 0x5A:
-        case 0x62: case 0x6A: case 0x72: case 0x7A: /* D */
-            dmg->processor.af.zero = !(dmg->processor.de.high & (1 << ((dmg->processor.instruction.opcode - 0x42) / 8)));
-            break;
-        case 0x43: case 0x4B: case 0x53: case 0x5B:
-        case 0x63: case 0x6B: case 0x73: case 0x7B: /* E */
-            dmg->processor.af.zero = !(dmg->processor.de.low & (1 << ((dmg->processor.instruction.opcode - 0x43) / 8)));
-            break;
-        case 0x44: case 0x4C: case 0x54: case 0x5C:
-        case 0x64: case 0x6C: case 0x74: case 0x7C: /* H */
-            dmg->processor.af.zero = !(dmg->processor.hl.high & (1 << ((dmg->processor.instruction.opcode - 0x44) / 8)));
-            break;
-        case 0x45: case 0x4D: case 0x55: case 0x5D:
-        case 0x65: case 0x6D: case 0x75: case 0x7D: /* L */
-            dmg->processor.af.zero = !(dmg->processor.hl.low & (1 << ((dmg->processor.instruction.opcode - 0x45) / 8)));
-            break;
-        case 0x46: case 0x4E: case 0x56: case 0x5E:
-        case 0x66: case 0x6E: case 0x76: case 0x7E: /* (HL) */
-            dmg->processor.delay += 4;
-            dmg->processor.af.zero = !(dmg_system_read(dmg, dmg->processor.hl.word) & (1 << ((dmg->processor.instruction.opcode - 0x46) / 8)));
-            break;
-        case 0x47: case 0x4F: case 0x57: case 0x5F:
-        case 0x67: case 0x6F: case 0x77: case 0x7F: /* A */
-            dmg->processor.af.zero = !(dmg->processor.af.high & (1 << ((dmg->processor.instruction.opcode - 0x47) / 8)));
-            break;
-    }
-    dmg->processor.af.half_carry = true;
-    dmg->processor.af.negative = false;
-}
-
-static void dmg_processor_instruction_call(dmg_t const dmg)
-{
-    bool taken = false;
-    dmg_register_t operand = {};
-    dmg->processor.delay = 12;
-    operand.low = dmg_system_read(dmg, dmg->processor.pc.word++);
-    operand.high = dmg_system_read(dmg, dmg->processor.pc.word++);
-    switch (dmg->processor.instruction.opcode)
-    {
-        case 0xC4: /* NZ */
-            taken = !dmg->processor.af.zero;
-            break;
-        case 0xCC: /* Z */
-            taken = dmg->processor.af.zero;
-            break;
-        case 0xCD: /* N */
-            taken = true;
-            break;
-        case 0xD4: /* NC */
-            taken = !dmg->processor.af.carry;
-            break;
-        case 0xDC: /* C */
-            taken = dmg->processor.af.carry;
-            break;
-    }
-    if (taken)
-    {
-        dmg->processor.delay += 12;
-        dmg_system_write(dmg, --dmg->processor.sp.word, dmg->processor.pc.high);
-        dmg_system_write(dmg, --dmg->processor.sp.word, dmg->processor.pc.low);
-        dmg->processor.pc.word = operand.word;
-    }
+    return sum;
 }
 
-static void dmg_processor_instruction_ccf(dmg_t const dmg)
+static void dmg_processor_and(dmg_t const dmg, uint8_t operand)
 {
-    dmg->processor.delay = 4;
-    dmg->processor.af.carry = !dmg->processor.af.carry;
-    dmg->processor.af.half_carry = false;
-    dmg->processor.af.negative = false;
+    dmg->processor.af.high &= operand;
+    dmg->processor.flag.operation = DMG_FLAG_AND;
+    dmg->processor.flag.result = dmg->processor.af.high;
 }
 
-static void dmg_processor_instruction_cp(dmg_t const dmg)
+static void dmg_processor_bit(dmg_t const dmg, uint8_t operand, uint8_t bit)
 {
-    uint8_t operand = 0;
-    dmg->processor.delay = 4;
-    switch (dmg->processor.instruction.opcode)
-    {
-        case 0xB8: /* B */
-            operand = dmg->processor.bc.high;
-            break;
-        case 0xB9: /* C */
-            operand = dmg->processor.bc.low;
-            break;
-        case 0xBA: /* D */
-            operand = dmg->processor.de.high;
-            break;
-        case 0xBB: /* E */
-            operand = dmg->processor.de.low;
-            break;
-        case 0xBC: /* H */
-            operand = dmg->processor.hl.high;
-            break;
-        case 0xBD: /* L */
-            operand = dmg->processor.hl.low;
-            break;
-        case 0xBE: /* (HL) */
-            dmg->processor.delay += 4;
-            operand = dmg_system_read(dmg, dmg->processor.hl.word);
-            break;
-        case 0xBF: /* A */
-            operand = dmg->processor.af.high;
-            break;
-        case 0xFE: /* # */
-            dmg->processor.delay += 4;
-            operand = dmg_system_read(dmg, dmg->processor.pc.word++);
-            break;
-    }
-    dmg->processor.af.carry = (dmg->processor.af.high < operand);
-    dmg->processor.af.half_carry = ((dmg->processor.af.high & 0x0F) < ((dmg->processor.af.high - operand) & 0x0F));
-    dmg->processor.af.negative = true;
-    dmg->processor.af.zero = (dmg->processor.af.high == operand);
+    dmg->processor.flag.carry = dmg_processor_carry(dmg);
+    dmg->processor.flag.operation = DMG_FLAG_BIT;
+    dmg->processor.flag.result = operand & (1 << bit);
 }
 
-static void dmg_processor_instruction_cpl(dmg_t const dmg)
+static void dmg_processor_cp(dmg_t const dmg, uint8_t operand)
 {
-    dmg->processor.delay = 4;
-    dmg->processor.af.high = ~dmg->processor.af.high;
-    dmg->processor.af.half_carry = true;
-    dmg->processor.af.negative = true;
+    dmg->processor.flag.operation = DMG_FLAG_SUB;
+    dmg->processor.flag.operand = dmg->processor.af.high ^ operand;
+    dmg->processor.flag.result = dmg->processor.af.high - operand;
 }
 
-static void dmg_processor_instruction_daa(dmg_t const dmg)
+#if defined(DMG_ALU_ARITHMETIC) || defined(DMG_ALU_VERIFY)
+static void dmg_processor_daa_arithmetic(dmg_t const dmg)
 {
-    dmg->processor.delay = 4;
     if (!dmg->processor.af.negative)
     {
         if (dmg->processor.af.carry || (dmg->processor.af.high > 0x99))
@@ -345,1651 +957,719 @@ static void dmg_processor_instruction_daa(dmg_t const dmg)
     dmg->processor.af.half_carry = false;
     dmg->processor.af.zero = !dmg->processor.af.high;
 }
+#endif /* DMG_ALU_ARITHMETIC || DMG_ALU_VERIFY */
 
-static void dmg_processor_instruction_di(dmg_t const dmg)
+static void dmg_processor_daa(dmg_t const dmg)
 {
-    dmg->processor.delay = 4;
-    dmg->processor.interrupt.enable_delay = 0;
-    dmg->processor.interrupt.enabled = false;
+    dmg_processor_flags(dmg);
+#ifndef DMG_ALU_ARITHMETIC
+    dmg->processor.af.word = dmg->processor.table.daa[dmg->processor.af.high | ((dmg->processor.af.low & 0x70) << 4)];
+#else
+    dmg_processor_daa_arithmetic(dmg);
+#endif /* DMG_ALU_ARITHMETIC */
 }
 
-static void dmg_processor_instruction_ei(dmg_t const dmg)
+static uint8_t dmg_processor_dec(dmg_t const dmg, uint8_t operand)
 {
-    dmg->processor.delay = 4;
-    if (!dmg->processor.interrupt.enable_delay)
-    {
-        dmg->processor.interrupt.enable_delay = 2;
-    }
+    --operand;
+    dmg->processor.flag.carry = dmg_processor_carry(dmg);
+    dmg->processor.flag.operation = DMG_FLAG_DEC;
+    dmg->processor.flag.result = operand;
+    return operand;
 }
 
-static void dmg_processor_instruction_dec(dmg_t const dmg)
+static void dmg_processor_idle(dmg_t const dmg)
 {
-    uint8_t operand = 0;
-    dmg->processor.delay = 4;
-    switch (dmg->processor.instruction.opcode)
+    uint8_t delay = dmg->processor.delay;
+    uint16_t address = dmg->processor.pc.word, cycles = delay, end = dmg->processor.instruction.address;
+    if ((end >= 0x8000) || dmg->processor.interrupt.enable_delay || (dmg->processor.interrupt.enable & dmg->processor.interrupt.flag & 0x1F))
     {
-        case 0x05: /* B */
-            operand = --dmg->processor.bc.high;
-            break;
-        case 0x0D: /* C */
-            operand = --dmg->processor.bc.low;
-            break;
-        case 0x15: /* D */
-            operand = --dmg->processor.de.high;
-            break;
-        case 0x1D: /* E */
-            operand = --dmg->processor.de.low;
-            break;
-        case 0x25: /* H */
-            operand = --dmg->processor.hl.high;
-            break;
-        case 0x2D: /* L */
-            operand = --dmg->processor.hl.low;
-            break;
-        case 0x35: /* (HL) */
-            dmg->processor.delay += 8;
-            operand = dmg_system_read(dmg, dmg->processor.hl.word) - 1;
-            dmg_system_write(dmg, dmg->processor.hl.word, operand);
-            break;
-        case 0x3D: /* A */
-            operand = --dmg->processor.af.high;
+        return;
+    }
+    while (cycles && (address < end))
+    { /* LOOP BODY MUST LOAD A AT MOST ONCE, FIRST, THEN ONLY TEST IT */
+        const dmg_decode_t *decode = &dmg->processor.cache.entry[address];
+        uint16_t source = 0;
+        if (!decode->length || (decode->bank != dmg->processor.cache.bank[address >> 8]))
+        {
             break;
+        }
+        switch (decode->index)
+        {
+            case 0xF0: /* LDH A,(N) */
+                source = 0xFF00 + decode->operand.low;
+                break;
+            case 0xFA: /* LD A,(NN) */
+                source = decode->operand.word;
+                break;
+            case 0xA7: case 0xB7: /* AND A, OR A */
+            case 0xE6: case 0xFE: /* AND N, CP N */
+            case 0x147: case 0x14F: case 0x157: case 0x15F: case 0x167: case 0x16F: case 0x177: case 0x17F: /* BIT N,A */
+                break;
+            default:
+                cycles = 0;
+                break;
+        }
+        if (cycles)
+        {
+            cycles += OPCODE[decode->index].cycles;
+        }
+        if (source)
+        {
+            switch (source)
+            {
+                case 0xC000 ... 0xDFFF: /* WORK RAM */
+                case 0xFF0F: /* IF */
+                case 0xFF41: /* STAT */
+                case 0xFF44: /* LY */
+                case 0xFF80 ... 0xFFFE: /* HIGH RAM */
+                    if (address != dmg->processor.pc.word)
+                    {
+                        cycles = 0;
+                    }
+                    break;
+                default:
+                    cycles = 0;
+                    break;
+            }
+        }
+        address += decode->length;
+    }
+    if (cycles && (address == end))
+    { /* POLLED VALUES ONLY CHANGE ON SCHEDULED EVENTS, SO SKIP WHOLE ITERATIONS UNTIL THE NEXT ONE */
+        uint64_t cycle = dmg->scheduler.cycle, timestamp = dmg_system_deadline(dmg);
+        if ((dmg->processor.idle.address == end) && ((dmg->processor.idle.cycle + cycles) == cycle) && (dmg->processor.idle.timestamp > cycle))
+        { /* PREVIOUS ITERATION RAN WITHOUT AN EVENT */
+            while (((dmg->processor.delay + cycles) <= 0xFF) && ((cycle + dmg->processor.delay + cycles) < timestamp))
+            {
+                dmg->processor.delay += cycles;
+            }
+        }
+        dmg->processor.idle.address = end;
+        dmg->processor.idle.cycle = cycle + dmg->processor.delay - delay;
+        dmg->processor.idle.timestamp = timestamp;
     }
-    dmg->processor.af.half_carry = ((operand & 0x0F) == 0x0F);
-    dmg->processor.af.negative = true;
-    dmg->processor.af.zero = !operand;
 }
 
-static void dmg_processor_instruction_dec_word(dmg_t const dmg)
+static uint8_t dmg_processor_inc(dmg_t const dmg, uint8_t operand)
 {
-    dmg->processor.delay = 8;
-    switch (dmg->processor.instruction.opcode)
-    {
-        case 0x0B: /* BC */
-            --dmg->processor.bc.word;
-            break;
-        case 0x1B: /* DE */
-            --dmg->processor.de.word;
-            break;
-        case 0x2B: /* HL */
-            --dmg->processor.hl.word;
-            break;
-        case 0x3B: /* SP */
-            --dmg->processor.sp.word;
-            break;
-    }
+    ++operand;
+    dmg->processor.flag.carry = dmg_processor_carry(dmg);
+    dmg->processor.flag.operation = DMG_FLAG_INC;
+    dmg->processor.flag.result = operand;
+    return operand;
 }
 
-static void dmg_processor_instruction_halt(dmg_t const dmg)
+static void dmg_processor_or(dmg_t const dmg, uint8_t operand)
 {
-    dmg->processor.delay = 4;
-    dmg->processor.halted = true;
+    dmg->processor.af.high |= operand;
+    dmg->processor.flag.operation = DMG_FLAG_LOGIC;
+    dmg->processor.flag.result = dmg->processor.af.high;
+}
+
+static uint8_t dmg_processor_rl(dmg_t const dmg, uint8_t operand)
+{
+    uint8_t carry = dmg_processor_carry(dmg);
+    dmg->processor.flag.operation = DMG_FLAG_SHIFT;
+    dmg->processor.flag.result = (operand << 1) | carry;
+    return dmg->processor.flag.result;
+}
+
+static uint8_t dmg_processor_rlc(dmg_t const dmg, uint8_t operand)
+{
+    dmg->processor.flag.operation = DMG_FLAG_SHIFT;
+    dmg->processor.flag.result = (operand << 1) | (operand >> 7);
+    return dmg->processor.flag.result;
+}
+
+static uint8_t dmg_processor_rr(dmg_t const dmg, uint8_t operand)
+{
+    uint8_t carry = dmg_processor_carry(dmg);
+    dmg->processor.flag.operation = DMG_FLAG_SHIFT;
+    dmg->processor.flag.result = ((operand & 1) << 8) | (carry << 7) | (operand >> 1);
+    return dmg->processor.flag.result;
+}
+
+static uint8_t dmg_processor_rrc(dmg_t const dmg, uint8_t operand)
+{
+    dmg->processor.flag.operation = DMG_FLAG_SHIFT;
+    dmg->processor.flag.result = ((operand & 1) << 8) | ((operand & 1) << 7) | (operand >> 1);
+    return dmg->processor.flag.result;
+}
+
+static void dmg_processor_sbc(dmg_t const dmg, uint8_t operand)
+{
+    uint16_t sum;
+    sum = dmg->processor.af.high - operand - dmg_processor_carry(dmg);
+    dmg->processor.flag.operation = DMG_FLAG_SUB;
+    dmg->processor.flag.operand = dmg->processor.af.high ^ operand;
+    dmg->processor.flag.result = sum;
+    dmg->processor.af.high = sum;
+}
+
+static uint8_t dmg_processor_sla(dmg_t const dmg, uint8_t operand)
+{
+    dmg->processor.flag.operation = DMG_FLAG_SHIFT;
+    dmg->processor.flag.result = operand << 1;
+    return dmg->processor.flag.result;
+}
+
+static uint8_t dmg_processor_sra(dmg_t const dmg, uint8_t operand)
+{
+    dmg->processor.flag.operation = DMG_FLAG_SHIFT;
+    dmg->processor.flag.result = ((operand & 1) << 8) | (operand & 0x80) | (operand >> 1);
+    return dmg->processor.flag.result;
+}
+
+static uint8_t dmg_processor_srl(dmg_t const dmg, uint8_t operand)
+{
+    dmg->processor.flag.operation = DMG_FLAG_SHIFT;
+    dmg->processor.flag.result = ((operand & 1) << 8) | (operand >> 1);
+    return dmg->processor.flag.result;
 }
 
-static void dmg_processor_instruction_inc(dmg_t const dmg)
+static void dmg_processor_sub(dmg_t const dmg, uint8_t operand)
 {
-    uint8_t operand = 0;
-    dmg->processor.delay = 4;
-    switch (dmg->processor.instruction.opcode)
+    uint16_t sum;
+    sum = dmg->processor.af.high - operand;
+    dmg->processor.flag.operation = DMG_FLAG_SUB;
+    dmg->processor.flag.operand = dmg->processor.af.high ^ operand;
+    dmg->processor.flag.result = sum;
+    dmg->processor.af.high = sum;
+}
+
+static uint8_t dmg_processor_swap(dmg_t const dmg, uint8_t operand)
+{
+    operand = (operand << 4) | (operand >> 4);
+    dmg->processor.flag.operation = DMG_FLAG_LOGIC;
+    dmg->processor.flag.result = operand;
+    return operand;
+}
+
+static void dmg_processor_xor(dmg_t const dmg, uint8_t operand)
+{
+    dmg->processor.af.high ^= operand;
+    dmg->processor.flag.operation = DMG_FLAG_LOGIC;
+    dmg->processor.flag.result = dmg->processor.af.high;
+}
+
+DMG_PROCESSOR_INSTRUCTION(DMG_INSTRUCTION)
+DMG_PROCESSOR_INSTRUCTION_EXTENDED(DMG_INSTRUCTION_EXTENDED)
+
+#define DMG_INSTRUCTION_ENTRY(_OPCODE_, ...) [0x##_OPCODE_] = dmg_processor_instruction_##_OPCODE_,
+#define DMG_INSTRUCTION_EXTENDED_ENTRY(_OPCODE_, ...) [256 + 0x##_OPCODE_] = dmg_processor_instruction_extended_##_OPCODE_,
+
+static const dmg_instruction_f INSTRUCTION[] =
+{
+    DMG_PROCESSOR_INSTRUCTION(DMG_INSTRUCTION_ENTRY)
+    DMG_PROCESSOR_INSTRUCTION_EXTENDED(DMG_INSTRUCTION_EXTENDED_ENTRY)
+};
+
+#ifdef DMG_THREADED
+#define DMG_THREAD_DISPATCH() \
+    if (dmg->processor.interrupt.enable_delay || (dmg->processor.interrupt.enable & dmg->processor.interrupt.flag & 0x1F) \
+            || dmg->processor.halted || dmg->processor.stopped) \
+    { \
+        goto step; \
+    } \
+    goto *LABEL[dmg_processor_decode(dmg)];
+
+#define DMG_THREAD_NEXT() \
+    if (dmg->scheduler.timestamp[dmg->scheduler.event[0]] <= (dmg->scheduler.cycle + dmg->processor.delay)) \
+    { \
+        return dmg->processor.delay; \
+    } \
+    dmg->scheduler.cycle += dmg->processor.delay; \
+    DMG_THREAD_DISPATCH()
+
+#define DMG_THREAD(_OPCODE_, _TEMPLATE_, _LENGTH_, _CYCLES_, _BRANCH_, _FLAGS_, _MNEMONIC_, ...) \
+    instruction_##_OPCODE_: \
+    { \
+        enum { DMG_BRANCH = _BRANCH_ }; \
+        dmg->processor.delay = _CYCLES_; \
+        DMG_INSTRUCTION_##_TEMPLATE_(__VA_ARGS__) \
+    } \
+    DMG_THREAD_NEXT()
+
+#define DMG_THREAD_EXTENDED(_OPCODE_, _TEMPLATE_, _LENGTH_, _CYCLES_, _BRANCH_, _FLAGS_, _MNEMONIC_, ...) \
+    instruction_extended_##_OPCODE_: \
+    { \
+        enum { DMG_BRANCH = _BRANCH_ }; \
+        dmg->processor.delay = _CYCLES_; \
+        DMG_INSTRUCTION_##_TEMPLATE_(__VA_ARGS__) \
+    } \
+    DMG_THREAD_NEXT()
+
+#define DMG_THREAD_ENTRY(_OPCODE_, ...) [0x##_OPCODE_] = &&instruction_##_OPCODE_,
+#define DMG_THREAD_EXTENDED_ENTRY(_OPCODE_, ...) [256 + 0x##_OPCODE_] = &&instruction_extended_##_OPCODE_,
+#endif /* DMG_THREADED */
+
+static void dmg_processor_fetch(dmg_t const dmg, uint16_t address, dmg_decode_t *const decode)
+{
+    decode->operand.word = 0;
+    if ((decode->index = dmg_system_read(dmg, address)) == 0xCB)
     {
-        case 0x04: /* B */
-            operand = ++dmg->processor.bc.high;
-            break;
-        case 0x0C: /* C */
-            operand = ++dmg->processor.bc.low;
-            break;
-        case 0x14: /* D */
-            operand = ++dmg->processor.de.high;
-            break;
-        case 0x1C: /* E */
-            operand = ++dmg->processor.de.low;
-            break;
-        case 0x24: /* H */
-            operand = ++dmg->processor.hl.high;
-            break;
-        case 0x2C: /* L */
-            operand = ++dmg->processor.hl.low;
-            break;
-        case 0x34: /* (HL) */
-            dmg->processor.delay += 8;
-            operand = dmg_system_read(dmg, dmg->processor.hl.word) + 1;
-            dmg_system_write(dmg, dmg->processor.hl.word, operand);
-            break;
-        case 0x3C: /* A */
-            operand = ++dmg->processor.af.high;
-            break;
+        decode->index = dmg_system_read(dmg, address + 1) + 256;
     }
-    dmg->processor.af.half_carry = !(operand & 0x0F);
-    dmg->processor.af.negative = false;
-    dmg->processor.af.zero = !operand;
+    else if (OPCODE[decode->index].length > 2)
+    {
+        decode->operand.word = dmg_system_read_word(dmg, address + 1);
+    }
+    else if (OPCODE[decode->index].length > 1)
+    {
+        decode->operand.low = dmg_system_read(dmg, address + 1);
+    }
+    decode->length = OPCODE[decode->index].length;
 }
 
-static void dmg_processor_instruction_inc_word(dmg_t const dmg)
+static void dmg_processor_cache(dmg_t const dmg, uint16_t address)
 {
-    dmg->processor.delay = 8;
-    switch (dmg->processor.instruction.opcode)
+    bool branch = false;
+    while (!branch && (address < 0x8000))
     {
-        case 0x03: /* BC */
-            ++dmg->processor.bc.word;
-            break;
-        case 0x13: /* DE */
-            ++dmg->processor.de.word;
-            break;
-        case 0x23: /* HL */
-            ++dmg->processor.hl.word;
+        dmg_decode_t *decode = &dmg->processor.cache.entry[address];
+        if (decode->length && (decode->bank == dmg->processor.cache.bank[address >> 8]))
+        {
             break;
-        case 0x33: /* SP */
-            ++dmg->processor.sp.word;
+        }
+        dmg_processor_fetch(dmg, address, decode);
+        if ((address & 0xC000) != ((address + decode->length - 1) & 0xC000))
+        { /* SPANS BANKS */
+            decode->length = 0;
             break;
+        }
+        decode->bank = dmg->processor.cache.bank[address >> 8];
+        branch = OPCODE[decode->index].branch;
+        address += decode->length;
     }
 }
 
-static void dmg_processor_instruction_jp(dmg_t const dmg)
+static uint16_t dmg_processor_decode(dmg_t const dmg)
 {
-    bool taken = false;
-    dmg_register_t operand = {};
-    dmg->processor.delay = 12;
-    operand.low = dmg_system_read(dmg, dmg->processor.pc.word++);
-    operand.high = dmg_system_read(dmg, dmg->processor.pc.word++);
-    switch (dmg->processor.instruction.opcode)
-    {
-        case 0xC2: /* NZ */
-            taken = !dmg->processor.af.zero;
-            break;
-        case 0xC3: /* N */
-            taken = true;
-            break;
-        case 0xCA: /* Z */
-            taken = dmg->processor.af.zero;
-            break;
-        case 0xD2: /* NC */
-            taken = !dmg->processor.af.carry;
-            break;
-        case 0xDA: /* C */
-            taken = dmg->processor.af.carry;
-            break;
+    dmg_decode_t *decode = NULL, fetch = {};
+    uint16_t address = dmg->processor.pc.word;
+    if (address < 0x8000)
+    { /* ROM */
+        decode = &dmg->processor.cache.entry[address];
+        if (!decode->length || (decode->bank != dmg->processor.cache.bank[address >> 8]))
+        {
+            dmg_processor_cache(dmg, address);
+        }
     }
-    if (taken)
+    if (!decode || !decode->length)
     {
-        dmg->processor.delay += 4;
-        dmg->processor.pc.word = operand.word;
+        dmg_processor_fetch(dmg, address, decode = &fetch);
     }
+    dmg->processor.instruction.address = address;
+    dmg->processor.instruction.opcode = decode->index;
+    dmg->processor.instruction.operand = decode->operand;
+    dmg->processor.pc.word += decode->length;
+    return decode->index;
 }
 
-static void dmg_processor_instruction_jp_hl(dmg_t const dmg)
+#ifdef DMG_JIT
+static void dmg_processor_emit(dmg_t const dmg, const void *const data, uint32_t length)
 {
-    dmg->processor.delay = 4;
-    dmg->processor.pc.word = dmg->processor.hl.word;
+    memcpy(&dmg->processor.jit.arena[dmg->processor.jit.offset], data, length);
+    dmg->processor.jit.offset += length;
 }
 
-static void dmg_processor_instruction_jr(dmg_t const dmg)
+static void dmg_processor_emit_address(dmg_t const dmg, const void *const opcode, uint32_t length, uint32_t offset)
 {
-    bool taken = false;
-    int8_t operand = dmg_system_read(dmg, dmg->processor.pc.word++);
-    dmg->processor.delay = 8;
-    switch (dmg->processor.instruction.opcode)
-    {
-        case 0x18: /* N */
-            taken = true;
-            break;
-        case 0x20: /* NZ */
-            taken = !dmg->processor.af.zero;
-            break;
-        case 0x28: /* Z */
-            taken = dmg->processor.af.zero;
-            break;
-        case 0x30: /* NC */
-            taken = !dmg->processor.af.carry;
-            break;
-        case 0x38: /* C */
-            taken = dmg->processor.af.carry;
-            break;
-    }
-    if (taken)
-    {
-        dmg->processor.delay += 4;
-        dmg->processor.pc.word += operand;
-    }
+    dmg_processor_emit(dmg, opcode, length);
+    dmg_processor_emit(dmg, &offset, sizeof (offset));
+}
+
+static void dmg_processor_emit_jump(dmg_t const dmg, const void *const opcode, uint32_t length, uint32_t target)
+{
+    int32_t displacement;
+    dmg_processor_emit(dmg, opcode, length);
+    displacement = target - (dmg->processor.jit.offset + sizeof (displacement));
+    dmg_processor_emit(dmg, &displacement, sizeof (displacement));
+}
+
+static bool dmg_processor_protect(dmg_t const dmg, uint32_t offset, int protection)
+{ /* COVERS EVERY PAGE THE LONGEST BLOCK STARTING AT OFFSET CAN TOUCH */
+    uint32_t begin = offset & ~(DMG_JIT_PAGE - 1), end = (offset + (DMG_JIT_LENGTH * DMG_JIT_INSTRUCTION) + DMG_JIT_PAGE - 1) & ~(DMG_JIT_PAGE - 1);
+    return !mprotect(&dmg->processor.jit.arena[begin], end - begin, protection);
 }
 
-static void dmg_processor_instruction_ld(dmg_t const dmg)
+static bool dmg_processor_translate(dmg_t const dmg, uint16_t address, dmg_block_t *const block)
 {
-    dmg_register_t operand = {};
-    dmg->processor.delay = 4;
-    switch (dmg->processor.instruction.opcode)
+    uint32_t exit, start;
+    dmg_processor_cache(dmg, address);
+    if (!dmg->processor.cache.entry[address].length)
     {
-        case 0x01: /* BC,## */
-            dmg->processor.delay += 8;
-            dmg->processor.bc.low = dmg_system_read(dmg, dmg->processor.pc.word++);
-            dmg->processor.bc.high = dmg_system_read(dmg, dmg->processor.pc.word++);
-            break;
-        case 0x02: /* (BC),A */
-            dmg->processor.delay += 4;
-            dmg_system_write(dmg, dmg->processor.bc.word, dmg->processor.af.high);
-            break;
-        case 0x06: /* B,# */
-            dmg->processor.delay += 4;
-            dmg->processor.bc.high = dmg_system_read(dmg, dmg->processor.pc.word++);
-            break;
-        case 0x08: /* (##),SP */
-            dmg->processor.delay += 16;
-            operand.low = dmg_system_read(dmg, dmg->processor.pc.word++);
-            operand.high = dmg_system_read(dmg, dmg->processor.pc.word++);
-            dmg_system_write(dmg, operand.word, dmg->processor.sp.low);
-            dmg_system_write(dmg, operand.word + 1, dmg->processor.sp.high);
-            break;
-        case 0x0A: /* A,(BC) */
-            dmg->processor.delay += 4;
-            dmg->processor.af.high = dmg_system_read(dmg, dmg->processor.bc.word);
-            break;
-        case 0x0E: /* C,# */
-            dmg->processor.delay += 4;
-            dmg->processor.bc.low = dmg_system_read(dmg, dmg->processor.pc.word++);
-            break;
-        case 0x11: /* DE,## */
-            dmg->processor.delay += 8;
-            dmg->processor.de.low = dmg_system_read(dmg, dmg->processor.pc.word++);
-            dmg->processor.de.high = dmg_system_read(dmg, dmg->processor.pc.word++);
-            break;
-        case 0x12: /* (DE),A */
-            dmg->processor.delay += 4;
-            dmg_system_write(dmg, dmg->processor.de.word, dmg->processor.af.high);
-            break;
-        case 0x16: /* D,# */
-            dmg->processor.delay += 4;
-            dmg->processor.de.high = dmg_system_read(dmg, dmg->processor.pc.word++);
-            break;
-        case 0x1A: /* A,(DE) */
-            dmg->processor.delay += 4;
-            dmg->processor.af.high = dmg_system_read(dmg, dmg->processor.de.word);
-            break;
-        case 0x1E: /* E,# */
-            dmg->processor.delay += 4;
-            dmg->processor.de.low = dmg_system_read(dmg, dmg->processor.pc.word++);
-            break;
-        case 0x21: /* HL,## */
-            dmg->processor.delay += 8;
-            dmg->processor.hl.low = dmg_system_read(dmg, dmg->processor.pc.word++);
-            dmg->processor.hl.high = dmg_system_read(dmg, dmg->processor.pc.word++);
-            break;
-        case 0x22: /* (HL+),A */
-            dmg->processor.delay += 4;
-            dmg_system_write(dmg, dmg->processor.hl.word++, dmg->processor.af.high);
-            break;
-        case 0x26: /* H,# */
-            dmg->processor.delay += 4;
-            dmg->processor.hl.high = dmg_system_read(dmg, dmg->processor.pc.word++);
-            break;
-        case 0x2A: /* A,(HL+) */
-            dmg->processor.delay += 4;
-            dmg->processor.af.high = dmg_system_read(dmg, dmg->processor.hl.word++);
-            break;
-        case 0x2E: /* L,# */
-            dmg->processor.delay += 4;
-            dmg->processor.hl.low = dmg_system_read(dmg, dmg->processor.pc.word++);
-            break;
-        case 0x31: /* SP,## */
-            dmg->processor.delay += 8;
-            dmg->processor.sp.low = dmg_system_read(dmg, dmg->processor.pc.word++);
-            dmg->processor.sp.high = dmg_system_read(dmg, dmg->processor.pc.word++);
-            break;
-        case 0x32: /* (HL-),A */
-            dmg->processor.delay += 4;
-            dmg_system_write(dmg, dmg->processor.hl.word--, dmg->processor.af.high);
-            break;
-        case 0x36: /* (HL),# */
-            dmg->processor.delay += 8;
-            dmg_system_write(dmg, dmg->processor.hl.word, dmg_system_read(dmg, dmg->processor.pc.word++));
-            break;
-        case 0x3A: /* A,(HL-) */
-            dmg->processor.delay += 4;
-            dmg->processor.af.high = dmg_system_read(dmg, dmg->processor.hl.word--);
-            break;
-        case 0x3E: /* A,# */
-            dmg->processor.delay += 4;
-            dmg->processor.af.high = dmg_system_read(dmg, dmg->processor.pc.word++);
-            break;
-        case 0x40: /* B,B */
-            break;
-        case 0x41: /* B,C */
-            dmg->processor.bc.high = dmg->processor.bc.low;
-            break;
-        case 0x42: /* B,D */
-            dmg->processor.bc.high = dmg->processor.de.high;
-            break;
-        case 0x43: /* B,E */
-            dmg->processor.bc.high = dmg->processor.de.low;
-            break;
-        case 0x44: /* B,H */
-            dmg->processor.bc.high = dmg->processor.hl.high;
-            break;
-        case 0x45: /* B,L */
-            dmg->processor.bc.high = dmg->processor.hl.low;
-            break;
-        case 0x46: /* B,(HL) */
-            dmg->processor.delay += 4;
-            dmg->processor.bc.high = dmg_system_read(dmg, dmg->processor.hl.word);
-            break;
-        case 0x47: /* B,A */
-            dmg->processor.bc.high = dmg->processor.af.high;
-            break;
-        case 0x48: /* C,B */
-            dmg->processor.bc.low = dmg->processor.bc.high;
-            break;
-        case 0x49: /* C,C */
-            break;
-        case 0x4A: /* C,D */
-            dmg->processor.bc.low = dmg->processor.de.high;
-            break;
-        case 0x4B: /* C,E */
-            dmg->processor.bc.low = dmg->processor.de.low;
-            break;
-        case 0x4C: /* C,H */
-            dmg->processor.bc.low = dmg->processor.hl.high;
-            break;
-        case 0x4D: /* C,L */
-            dmg->processor.bc.low = dmg->processor.hl.low;
-            break;
-        case 0x4E: /* C,(HL) */
-            dmg->processor.delay += 4;
-            dmg->processor.bc.low = dmg_system_read(dmg, dmg->processor.hl.word);
-            break;
-        case 0x4F: /* C,A */
-            dmg->processor.bc.low = dmg->processor.af.high;
-            break;
-        case 0x50: /* D,B */
-            dmg->processor.de.high = dmg->processor.bc.high;
-            break;
-        case 0x51: /* D,C */
-            dmg->processor.de.high = dmg->processor.bc.low;
-            break;
-        case 0x52: /* D,D */
-            break;
-        case 0x53: /* D,E */
-            dmg->processor.de.high = dmg->processor.de.low;
-            break;
-        case 0x54: /* D,H */
-            dmg->processor.de.high = dmg->processor.hl.high;
-            break;
-        case 0x55: /* D,L */
-            dmg->processor.de.high = dmg->processor.hl.low;
-            break;
-        case 0x56: /* D,(HL) */
-            dmg->processor.delay += 4;
-            dmg->processor.de.high = dmg_system_read(dmg, dmg->processor.hl.word);
-            break;
-        case 0x57: /* D,A */
-            dmg->processor.de.high = dmg->processor.af.high;
-            break;
-        case 0x58: /* E,B */
-            dmg->processor.de.low = dmg->processor.bc.high;
-            break;
-        case 0x59: /* E,C */
-            dmg->processor.de.low = dmg->processor.bc.low;
-            break;
-        case 0x5A: /* E,D */
-            dmg->processor.de.low = dmg->processor.de.high;
-            break;
-        case 0x5B: /* E,E */
-            break;
-        case 0x5C: /* E,H */
-            dmg->processor.de.low = dmg->processor.hl.high;
-            break;
-        case 0x5D: /* E,L */
-            dmg->processor.de.low = dmg->processor.hl.low;
-            break;
-        case 0x5E: /* E,(HL) */
-            dmg->processor.delay += 4;
-            dmg->processor.de.low = dmg_system_read(dmg, dmg->processor.hl.word);
-            break;
-        case 0x5F: /* E,A */
-            dmg->processor.de.low = dmg->processor.af.high;
-            break;
-        case 0x60: /* H,B */
-            dmg->processor.hl.high = dmg->processor.bc.high;
-            break;
-        case 0x61: /* H,C */
-            dmg->processor.hl.high = dmg->processor.bc.low;
-            break;
-        case 0x62: /* H,D */
-            dmg->processor.hl.high = dmg->processor.de.high;
-            break;
-        case 0x63: /* H,E */
-            dmg->processor.hl.high = dmg->processor.de.low;
-            break;
-        case 0x64: /* H,H */
-            break;
-        case 0x65: /* H,L */
-            dmg->processor.hl.high = dmg->processor.hl.low;
-            break;
-        case 0x66: /* H,(HL) */
-            dmg->processor.delay += 4;
-            dmg->processor.hl.high = dmg_system_read(dmg, dmg->processor.hl.word);
-            break;
-        case 0x67: /* H,A */
-            dmg->processor.hl.high = dmg->processor.af.high;
-            break;
-        case 0x68: /* L,B */
-            dmg->processor.hl.low = dmg->processor.bc.high;
-            break;
-        case 0x69: /* L,C */
-            dmg->processor.hl.low = dmg->processor.bc.low;
-            break;
-        case 0x6A: /* L,D */
-            dmg->processor.hl.low = dmg->processor.de.high;
-            break;
-        case 0x6B: /* L,E */
-            dmg->processor.hl.low = dmg->processor.de.low;
-            break;
-        case 0x6C: /* L,H */
-            dmg->processor.hl.low = dmg->processor.hl.high;
-            break;
-        case 0x6D: /* L,L */
-            break;
-        case 0x6E: /* L,(HL) */
-            dmg->processor.delay += 4;
-            dmg->processor.hl.low = dmg_system_read(dmg, dmg->processor.hl.word);
-            break;
-        case 0x6F: /* L,A */
-            dmg->processor.hl.low = dmg->processor.af.high;
-            break;
-        case 0x70: /* (HL),B */
-            dmg->processor.delay += 4;
-            dmg_system_write(dmg, dmg->processor.hl.word, dmg->processor.bc.high);
-            break;
-        case 0x71: /* (HL),C */
-            dmg->processor.delay += 4;
-            dmg_system_write(dmg, dmg->processor.hl.word, dmg->processor.bc.low);
-            break;
-        case 0x72: /* (HL),D */
-            dmg->processor.delay += 4;
-            dmg_system_write(dmg, dmg->processor.hl.word, dmg->processor.de.high);
-            break;
-        case 0x73: /* (HL),E */
-            dmg->processor.delay += 4;
-            dmg_system_write(dmg, dmg->processor.hl.word, dmg->processor.de.low);
-            break;
-        case 0x74: /* (HL),H */
-            dmg->processor.delay += 4;
-            dmg_system_write(dmg, dmg->processor.hl.word, dmg->processor.hl.high);
-            break;
-        case 0x75: /* (HL),L */
-            dmg->processor.delay += 4;
-            dmg_system_write(dmg, dmg->processor.hl.word, dmg->processor.hl.low);
-            break;
-        case 0x77: /* (HL),A */
-            dmg->processor.delay += 4;
-            dmg_system_write(dmg, dmg->processor.hl.word, dmg->processor.af.high);
-            break;
-        case 0x78: /* A,B */
-            dmg->processor.af.high = dmg->processor.bc.high;
-            break;
-        case 0x79: /* A,C */
-            dmg->processor.af.high = dmg->processor.bc.low;
-            break;
-        case 0x7A: /* A,D */
-            dmg->processor.af.high = dmg->processor.de.high;
-            break;
-        case 0x7B: /* A,E */
-            dmg->processor.af.high = dmg->processor.de.low;
-            break;
-        case 0x7C: /* A,H */
-            dmg->processor.af.high = dmg->processor.hl.high;
-            break;
-        case 0x7D: /* A,L */
-            dmg->processor.af.high = dmg->processor.hl.low;
-            break;
-        case 0x7E: /* A,(HL) */
-            dmg->processor.delay += 4;
-            dmg->processor.af.high = dmg_system_read(dmg, dmg->processor.hl.word);
-            break;
-        case 0x7F: /* A,A */
-            break;
-        case 0xE0: /* (FF00+#),A */
-            dmg->processor.delay += 8;
-            dmg_system_write(dmg, 0xFF00 + dmg_system_read(dmg, dmg->processor.pc.word++), dmg->processor.af.high);
-            break;
-        case 0xE2: /* (FF00+C),A */
-            dmg->processor.delay += 4;
-            dmg_system_write(dmg, 0xFF00 + dmg->processor.bc.low, dmg->processor.af.high);
-            break;
-        case 0xEA: /* (##),A */
-            dmg->processor.delay += 12;
-            operand.low = dmg_system_read(dmg, dmg->processor.pc.word++);
-            operand.high = dmg_system_read(dmg, dmg->processor.pc.word++);
-            dmg_system_write(dmg, operand.word, dmg->processor.af.high);
-            break;
-        case 0xF0: /* A,(FF00+#) */
-            dmg->processor.delay += 8;
-            dmg->processor.af.high = dmg_system_read(dmg, 0xFF00 + dmg_system_read(dmg, dmg->processor.pc.word++));
-            break;
-        case 0xF2: /* A,(FF00+C) */
-            dmg->processor.delay += 4;
-            dmg->processor.af.high = dmg_system_read(dmg, 0xFF00 + dmg->processor.bc.low);
-            break;
-        case 0xF9: /* SP,HL */
-            dmg->processor.delay += 4;
-            dmg->processor.sp.word = dmg->processor.hl.word;
-            break;
-        case 0xFA: /* A,(##) */
-            dmg->processor.delay += 12;
-            operand.low = dmg_system_read(dmg, dmg->processor.pc.word++);
-            operand.high = dmg_system_read(dmg, dmg->processor.pc.word++);
-            dmg->processor.af.high = dmg_system_read(dmg, operand.word);
-            break;
+        return false;
     }
-}
-
-static void dmg_processor_instruction_ld_hl(dmg_t const dmg)
-{
-    uint32_t carry, sum;
-    int8_t operand = dmg_system_read(dmg, dmg->processor.pc.word++);
-    dmg->processor.delay = 12;
-    sum = dmg->processor.sp.word + operand;
-    carry = dmg->processor.sp.word ^ operand ^ sum;
-    dmg->processor.af.carry = ((carry & 0x100) == 0x100);
-    dmg->processor.af.half_carry = ((carry & 0x10) == 0x10);
-    dmg->processor.af.negative = false;
-    dmg->processor.af.zero = false;
-    dmg->processor.hl.word = sum;
-}
-
-static void dmg_processor_instruction_nop(dmg_t const dmg)
-{
-    dmg->processor.delay = 4;
-}
-
-static void dmg_processor_instruction_or(dmg_t const dmg)
-{
-    dmg->processor.delay = 4;
-    switch (dmg->processor.instruction.opcode)
-    {
-        case 0xB0: /* B */
-            dmg->processor.af.high |= dmg->processor.bc.high;
-            break;
-        case 0xB1: /* C */
-            dmg->processor.af.high |= dmg->processor.bc.low;
-            break;
-        case 0xB2: /* D */
-            dmg->processor.af.high |= dmg->processor.de.high;
-            break;
-        case 0xB3: /* E */
-            dmg->processor.af.high |= dmg->processor.de.low;
-            break;
-        case 0xB4: /* H */
-            dmg->processor.af.high |= dmg->processor.hl.high;
-            break;
-        case 0xB5: /* L */
-            dmg->processor.af.high |= dmg->processor.hl.low;
-            break;
-        case 0xB6: /* (HL) */
-            dmg->processor.delay += 4;
-            dmg->processor.af.high |= dmg_system_read(dmg, dmg->processor.hl.word);
-            break;
-        case 0xB7: /* A */
-            break;
-        case 0xF6: /* # */
-            dmg->processor.delay += 4;
-            dmg->processor.af.high |= dmg_system_read(dmg, dmg->processor.pc.word++);
-            break;
+    if ((dmg->processor.jit.offset + (DMG_JIT_LENGTH * DMG_JIT_INSTRUCTION)) > DMG_JIT_ARENA)
+    { /* ARENA FULL */
+        memset(dmg->processor.jit.block, 0, 0x8000 * sizeof (*dmg->processor.jit.block));
+        dmg->processor.jit.offset = 0;
+        block->bank = dmg->processor.cache.bank[address >> 8];
     }
-    dmg->processor.af.carry = false;
-    dmg->processor.af.half_carry = false;
-    dmg->processor.af.negative = false;
-    dmg->processor.af.zero = !dmg->processor.af.high;
-}
-
-static void dmg_processor_instruction_pop(dmg_t const dmg)
-{
-    dmg->processor.delay = 12;
-    switch (dmg->processor.instruction.opcode)
+    if (!dmg_processor_protect(dmg, start = dmg->processor.jit.offset, PROT_READ | PROT_WRITE))
+    { /* ARENA IS NEVER WRITABLE AND EXECUTABLE AT ONCE */
+        return false;
+    }
+    exit = dmg->processor.jit.offset;
+    dmg_processor_emit(dmg, (const uint8_t []){ 0x5B, 0xC3 }, 2); /* pop rbx; ret */
+    block->entry = (dmg_block_f)&dmg->processor.jit.arena[dmg->processor.jit.offset];
+    dmg_processor_emit(dmg, (const uint8_t []){ 0x53, 0x48, 0x89, 0xFB }, 4); /* push rbx; mov rbx, rdi */
+    for (uint8_t count = 1;; ++count)
     {
-        case 0xC1: /* BC */
-            dmg->processor.bc.low = dmg_system_read(dmg, dmg->processor.sp.word++);
-            dmg->processor.bc.high = dmg_system_read(dmg, dmg->processor.sp.word++);
-            break;
-        case 0xD1: /* DE */
-            dmg->processor.de.low = dmg_system_read(dmg, dmg->processor.sp.word++);
-            dmg->processor.de.high = dmg_system_read(dmg, dmg->processor.sp.word++);
-            break;
-        case 0xE1: /* HL */
-            dmg->processor.hl.low = dmg_system_read(dmg, dmg->processor.sp.word++);
-            dmg->processor.hl.high = dmg_system_read(dmg, dmg->processor.sp.word++);
-            break;
-        case 0xF1: /* AF */
-            dmg->processor.af.low = dmg_system_read(dmg, dmg->processor.sp.word++) & 0xF0;
-            dmg->processor.af.high = dmg_system_read(dmg, dmg->processor.sp.word++);
+        const dmg_decode_t *decode = &dmg->processor.cache.entry[address];
+        uint16_t next = address + decode->length;
+        uintptr_t handler = (uintptr_t)INSTRUCTION[decode->index];
+        bool last = (count == DMG_JIT_LENGTH) || OPCODE[decode->index].branch || (decode->index == 0xFB) || (next >= 0x8000);
+        if (!last)
+        {
+            dmg_processor_cache(dmg, next);
+            last = !dmg->processor.cache.entry[next].length;
+        }
+        dmg_processor_emit_address(dmg, (const uint8_t []){ 0x66, 0xC7, 0x83 }, 3, DMG_OFFSET(processor.pc)); /* mov word [pc], next */
+        dmg_processor_emit(dmg, &next, sizeof (next));
+        if ((decode->index < 256) && (decode->length > 1))
+        {
+            dmg_processor_emit_address(dmg, (const uint8_t []){ 0x66, 0xC7, 0x83 }, 3, DMG_OFFSET(processor.instruction.operand)); /* mov word [operand], operand */
+            dmg_processor_emit(dmg, &decode->operand.word, sizeof (decode->operand.word));
+        }
+        if (last)
+        {
+            dmg_processor_emit_address(dmg, (const uint8_t []){ 0x66, 0xC7, 0x83 }, 3, DMG_OFFSET(processor.instruction.address)); /* mov word [address], address */
+            dmg_processor_emit(dmg, &address, sizeof (address));
+            dmg_processor_emit_address(dmg, (const uint8_t []){ 0xC6, 0x83 }, 2, DMG_OFFSET(processor.instruction.opcode)); /* mov byte [opcode], opcode */
+            dmg_processor_emit(dmg, &decode->index, sizeof (uint8_t));
+        }
+        dmg_processor_emit(dmg, (const uint8_t []){ 0x48, 0x89, 0xDF, 0x48, 0xB8 }, 5); /* mov rdi, rbx; mov rax, handler */
+        dmg_processor_emit(dmg, &handler, sizeof (handler));
+        dmg_processor_emit(dmg, (const uint8_t []){ 0xFF, 0xD0 }, 2); /* call rax */
+        dmg_processor_emit_address(dmg, (const uint8_t []){ 0x0F, 0xB6, 0x83 }, 3, DMG_OFFSET(processor.delay)); /* movzx eax, byte [delay] */
+        if (last)
+        {
+            dmg_processor_emit_jump(dmg, (const uint8_t []){ 0xE9 }, 1, exit); /* jmp exit */
             break;
+        }
+        dmg_processor_emit_address(dmg, (const uint8_t []){ 0x48, 0x8B, 0x8B }, 3, DMG_OFFSET(scheduler.cycle)); /* mov rcx, [cycle] */
+        dmg_processor_emit(dmg, (const uint8_t []){ 0x48, 0x01, 0xC1 }, 3); /* add rcx, rax */
+        dmg_processor_emit_address(dmg, (const uint8_t []){ 0x0F, 0xB6, 0x93 }, 3, DMG_OFFSET(scheduler.event)); /* movzx edx, byte [event] */
+        dmg_processor_emit_address(dmg, (const uint8_t []){ 0x48, 0x39, 0x8C, 0xD3 }, 4, DMG_OFFSET(scheduler.timestamp)); /* cmp [timestamp + rdx * 8], rcx */
+        dmg_processor_emit_jump(dmg, (const uint8_t []){ 0x0F, 0x86 }, 2, exit); /* jbe exit */
+        dmg_processor_emit_address(dmg, (const uint8_t []){ 0x80, 0xBB }, 2, DMG_OFFSET(processor.interrupt.enable_delay)); /* cmp byte [enable_delay], 0 */
+        dmg_processor_emit(dmg, (const uint8_t []){ 0x00 }, 1);
+        dmg_processor_emit_jump(dmg, (const uint8_t []){ 0x0F, 0x85 }, 2, exit); /* jne exit */
+        dmg_processor_emit_address(dmg, (const uint8_t []){ 0x66, 0x81, 0xBB }, 3, DMG_OFFSET(processor.cache.bank) + ((next >> 8) * sizeof (uint16_t))); /* cmp word [bank], bank */
+        dmg_processor_emit(dmg, &dmg->processor.cache.entry[next].bank, sizeof (uint16_t));
+        dmg_processor_emit_jump(dmg, (const uint8_t []){ 0x0F, 0x85 }, 2, exit); /* jne exit */
+        dmg_processor_emit_address(dmg, (const uint8_t []){ 0x80, 0xBB }, 2, DMG_OFFSET(processor.interrupt.enabled)); /* cmp byte [enabled], 0 */
+        dmg_processor_emit(dmg, (const uint8_t []){ 0x00, 0x74, 0x15 }, 3); /* je +21 */
+        dmg_processor_emit_address(dmg, (const uint8_t []){ 0x8A, 0x93 }, 2, DMG_OFFSET(processor.interrupt.enable)); /* mov dl, [enable] */
+        dmg_processor_emit_address(dmg, (const uint8_t []){ 0x22, 0x93 }, 2, DMG_OFFSET(processor.interrupt.flag)); /* and dl, [flag] */
+        dmg_processor_emit(dmg, (const uint8_t []){ 0xF6, 0xC2, 0x1F }, 3); /* test dl, 0x1F */
+        dmg_processor_emit_jump(dmg, (const uint8_t []){ 0x0F, 0x85 }, 2, exit); /* jne exit */
+        dmg_processor_emit_address(dmg, (const uint8_t []){ 0x48, 0x89, 0x8B }, 3, DMG_OFFSET(scheduler.cycle)); /* mov [cycle], rcx */
+        address = next;
     }
-}
-
-static void dmg_processor_instruction_push(dmg_t const dmg)
-{
-    dmg->processor.delay = 16;
-    switch (dmg->processor.instruction.opcode)
+    if (!dmg_processor_protect(dmg, start, PROT_READ | PROT_EXEC))
     {
-        case 0xC5: /* BC */
-            dmg_system_write(dmg, --dmg->processor.sp.word, dmg->processor.bc.high);
-            dmg_system_write(dmg, --dmg->processor.sp.word, dmg->processor.bc.low);
-            break;
-        case 0xD5: /* DE */
-            dmg_system_write(dmg, --dmg->processor.sp.word, dmg->processor.de.high);
-            dmg_system_write(dmg, --dmg->processor.sp.word, dmg->processor.de.low);
-            break;
-        case 0xE5: /* HL */
-            dmg_system_write(dmg, --dmg->processor.sp.word, dmg->processor.hl.high);
-            dmg_system_write(dmg, --dmg->processor.sp.word, dmg->processor.hl.low);
-            break;
-        case 0xF5: /* AF */
-            dmg_system_write(dmg, --dmg->processor.sp.word, dmg->processor.af.high);
-            dmg_system_write(dmg, --dmg->processor.sp.word, dmg->processor.af.low);
-            break;
+        block->entry = NULL;
+        return false;
     }
+    return true;
 }
 
-static void dmg_processor_instruction_res(dmg_t const dmg)
+static dmg_block_f dmg_processor_lookup(dmg_t const dmg)
 {
-    dmg->processor.delay = 8;
-    switch (dmg->processor.instruction.opcode)
+    dmg_block_t *block;
+    uint16_t address = dmg->processor.pc.word;
+    if (!dmg->processor.jit.block || (address >= 0x8000))
     {
-        case 0x80: case 0x88: case 0x90: case 0x98:
-        case 0xA0: case 0xA8: case 0xB0: case 0xB8: /* B */
-            dmg->processor.bc.high &= ~(1 << ((dmg->processor.instruction.opcode - 0x80) / 8));
-            break;
-        case 0x81: case 0x89: case 0x91: case 0x99:
-        case 0xA1: case 0xA9: case 0xB1: case 0xB9: /* C */
-            dmg->processor.bc.low &= ~(1 << ((dmg->processor.instruction.opcode - 0x81) / 8));
-            break;
-        case 0x82: case 0x8A: case 0x92: case 0x9A:
-        case 0xA2: case 0xAA: case 0xB2: case 0xBA: /* D */
-            dmg->processor.de.high &= ~(1 << ((dmg->processor.instruction.opcode - 0x82) / 8));
-            break;
-        case 0x83: case 0x8B: case 0x93: case 0x9B:
-        case 0xA3: case 0xAB: case 0xB3: case 0xBB: /* E */
-            dmg->processor.de.low &= ~(1 << ((dmg->processor.instruction.opcode - 0x83) / 8));
-            break;
-        case 0x84: case 0x8C: case 0x94: case 0x9C:
-        case 0xA4: case 0xAC: case 0xB4: case 0xBC: /* H */
-            dmg->processor.hl.high &= ~(1 << ((dmg->processor.instruction.opcode - 0x84) / 8));
-            break;
-        case 0x85: case 0x8D: case 0x95: case 0x9D:
-        case 0xA5: case 0xAD: case 0xB5: case 0xBD: /* L */
-            dmg->processor.hl.low &= ~(1 << ((dmg->processor.instruction.opcode - 0x85) / 8));
-            break;
-        case 0x86: case 0x8E: case 0x96: case 0x9E:
-        case 0xA6: case 0xAE: case 0xB6: case 0xBE: /* (HL) */
-            dmg->processor.delay += 8;
-            dmg_system_write(dmg, dmg->processor.hl.word, dmg_system_read(dmg, dmg->processor.hl.word)
-                & ~(1 << ((dmg->processor.instruction.opcode - 0x86) / 8)));
-            break;
-        case 0x87: case 0x8F: case 0x97: case 0x9F:
-        case 0xA7: case 0xAF: case 0xB7: case 0xBF: /* A */
-            dmg->processor.af.high &= ~(1 << ((dmg->processor.instruction.opcode - 0x87) / 8));
-            break;
+        return NULL;
     }
-}
-
-static void dmg_processor_instruction_ret(dmg_t const dmg)
-{
-    bool taken = false;
-    dmg->processor.delay = 8;
-    switch (dmg->processor.instruction.opcode)
+    block = &dmg->processor.jit.block[address];
+    if (block->bank != dmg->processor.cache.bank[address >> 8])
     {
-        case 0xC0: /* NZ */
-            taken = !dmg->processor.af.zero;
-            break;
-        case 0xC8: /* Z */
-            taken = dmg->processor.af.zero;
-            break;
-        case 0xC9: /* N */
-            taken = true;
-            break;
-        case 0xD0: /* NC */
-            taken = !dmg->processor.af.carry;
-            break;
-        case 0xD8: /* C */
-            taken = dmg->processor.af.carry;
-            break;
+        block->bank = dmg->processor.cache.bank[address >> 8];
+        block->count = 0;
+        block->entry = NULL;
     }
-    if (taken)
+    if (!block->entry && (++block->count >= DMG_JIT_THRESHOLD) && !dmg_processor_translate(dmg, address, block))
     {
-        dmg->processor.delay += (dmg->processor.instruction.opcode == 0xC9) ? 8 : 12; /* N */
-        dmg->processor.pc.low = dmg_system_read(dmg, dmg->processor.sp.word++);
-        dmg->processor.pc.high = dmg_system_read(dmg, dmg->processor.sp.word++);
+        block->count = 0;
     }
+    return block->entry;
 }
+#endif /* DMG_JIT */
 
-static void dmg_processor_instruction_reti(dmg_t const dmg)
+#ifdef DMG_TRACE
+static void dmg_processor_trace(dmg_t const dmg)
 {
-    dmg->processor.delay = 16;
-    dmg->processor.pc.low = dmg_system_read(dmg, dmg->processor.sp.word++);
-    dmg->processor.pc.high = dmg_system_read(dmg, dmg->processor.sp.word++);
-    dmg->processor.interrupt.enable_delay = 0;
-    dmg->processor.interrupt.enabled = true;
+    char mnemonic[32];
+    dmg_processor_disassemble(dmg, dmg->processor.pc.word, mnemonic, sizeof (mnemonic));
+    dmg_processor_flags(dmg);
+    fprintf(stderr, "[%04X] %-20s AF=%04X BC=%04X DE=%04X HL=%04X SP=%04X CYCLE=%llu\n", dmg->processor.pc.word, mnemonic, dmg->processor.af.word, dmg->processor.bc.word, dmg->processor.de.word, dmg->processor.hl.word, dmg->processor.sp.word, (unsigned long long)dmg->scheduler.cycle);
 }
+#endif /* DMG_TRACE */
 
-static void dmg_processor_instruction_rl(dmg_t const dmg)
+static void dmg_processor_execute(dmg_t const dmg)
 {
-    uint8_t carry = dmg->processor.af.carry, operand = 0;
-    dmg->processor.delay = 8;
-    switch (dmg->processor.instruction.opcode)
+#ifdef DMG_JIT
+    dmg_block_f block;
+    if ((block = dmg_processor_lookup(dmg)))
     {
-        case 0x10: /* B */
-            dmg->processor.af.carry = ((dmg->processor.bc.high & 0x80) == 0x80);
-            dmg->processor.bc.high = (dmg->processor.bc.high << 1) | carry;
-            dmg->processor.af.zero = !dmg->processor.bc.high;
-            break;
-        case 0x11: /* C */
-            dmg->processor.af.carry = ((dmg->processor.bc.low & 0x80) == 0x80);
-            dmg->processor.bc.low = (dmg->processor.bc.low << 1) | carry;
-            dmg->processor.af.zero = !dmg->processor.bc.low;
-            break;
-        case 0x12: /* D */
-            dmg->processor.af.carry = ((dmg->processor.de.high & 0x80) == 0x80);
-            dmg->processor.de.high = (dmg->processor.de.high << 1) | carry;
-            dmg->processor.af.zero = !dmg->processor.de.high;
-            break;
-        case 0x13: /* E */
-            dmg->processor.af.carry = ((dmg->processor.de.low & 0x80) == 0x80);
-            dmg->processor.de.low = (dmg->processor.de.low << 1) | carry;
-            dmg->processor.af.zero = !dmg->processor.de.low;
-            break;
-        case 0x14: /* H */
-            dmg->processor.af.carry = ((dmg->processor.hl.high & 0x80) == 0x80);
-            dmg->processor.hl.high = (dmg->processor.hl.high << 1) | carry;
-            dmg->processor.af.zero = !dmg->processor.hl.high;
-            break;
-        case 0x15: /* L */
-            dmg->processor.af.carry = ((dmg->processor.hl.low & 0x80) == 0x80);
-            dmg->processor.hl.low = (dmg->processor.hl.low << 1) | carry;
-            dmg->processor.af.zero = !dmg->processor.hl.low;
-            break;
-        case 0x16: /* (HL) */
-            dmg->processor.delay += 8;
-            operand = dmg_system_read(dmg, dmg->processor.hl.word);
-            dmg->processor.af.carry = ((operand & 0x80) == 0x80);
-            operand = (operand << 1) | carry;
-            dmg->processor.af.zero = !operand;
-            dmg_system_write(dmg, dmg->processor.hl.word, operand);
-            break;
-        case 0x17: /* A */
-            dmg->processor.af.carry = ((dmg->processor.af.high & 0x80) == 0x80);
-            dmg->processor.af.high = (dmg->processor.af.high << 1) | carry;
-            dmg->processor.af.zero = !dmg->processor.af.high;
-            break;
+        dmg->processor.delay = block(dmg);
     }
-    dmg->processor.af.half_carry = false;
-    dmg->processor.af.negative = false;
-}
-
-static void dmg_processor_instruction_rla(dmg_t const dmg)
-{
-    uint8_t carry = dmg->processor.af.carry;
-    dmg->processor.delay = 4;
-    dmg->processor.af.carry = ((dmg->processor.af.high & 0x80) == 0x80);
-    dmg->processor.af.high = (dmg->processor.af.high << 1) | carry;
-    dmg->processor.af.half_carry = false;
-    dmg->processor.af.negative = false;
-    dmg->processor.af.zero = false;
-}
-
-static void dmg_processor_instruction_rlc(dmg_t const dmg)
-{
-    uint8_t operand = 0;
-    dmg->processor.delay = 8;
-    switch (dmg->processor.instruction.opcode)
+    else
+#endif /* DMG_JIT */
     {
-        case 0x00: /* B */
-            dmg->processor.af.carry = ((dmg->processor.bc.high & 0x80) == 0x80);
-            dmg->processor.bc.high = (dmg->processor.bc.high << 1) | dmg->processor.af.carry;
-            dmg->processor.af.zero = !dmg->processor.bc.high;
-            break;
-        case 0x01: /* C */
-            dmg->processor.af.carry = ((dmg->processor.bc.low & 0x80) == 0x80);
-            dmg->processor.bc.low = (dmg->processor.bc.low << 1) | dmg->processor.af.carry;
-            dmg->processor.af.zero = !dmg->processor.bc.low;
-            break;
-        case 0x02: /* D */
-            dmg->processor.af.carry = ((dmg->processor.de.high & 0x80) == 0x80);
-            dmg->processor.de.high = (dmg->processor.de.high << 1) | dmg->processor.af.carry;
-            dmg->processor.af.zero = !dmg->processor.de.high;
-            break;
-        case 0x03: /* E */
-            dmg->processor.af.carry = ((dmg->processor.de.low & 0x80) == 0x80);
-            dmg->processor.de.low = (dmg->processor.de.low << 1) | dmg->processor.af.carry;
-            dmg->processor.af.zero = !dmg->processor.de.low;
-            break;
-        case 0x04: /* H */
-            dmg->processor.af.carry = ((dmg->processor.hl.high & 0x80) == 0x80);
-            dmg->processor.hl.high = (dmg->processor.hl.high << 1) | dmg->processor.af.carry;
-            dmg->processor.af.zero = !dmg->processor.hl.high;
-            break;
-        case 0x05: /* L */
-            dmg->processor.af.carry = ((dmg->processor.hl.low & 0x80) == 0x80);
-            dmg->processor.hl.low = (dmg->processor.hl.low << 1) | dmg->processor.af.carry;
-            dmg->processor.af.zero = !dmg->processor.hl.low;
-            break;
-        case 0x06: /* (HL) */
-            dmg->processor.delay += 8;
-            operand = dmg_system_read(dmg, dmg->processor.hl.word);
-            dmg->processor.af.carry = ((operand & 0x80) == 0x80);
-            operand = (operand << 1) | dmg->processor.af.carry;
-            dmg->processor.af.zero = !operand;
-            dmg_system_write(dmg, dmg->processor.hl.word, operand);
-            break;
-        case 0x07: /* A */
-            dmg->processor.af.carry = ((dmg->processor.af.high & 0x80) == 0x80);
-            dmg->processor.af.high = (dmg->processor.af.high << 1) | dmg->processor.af.carry;
-            dmg->processor.af.zero = !dmg->processor.af.high;
-            break;
+#ifdef DMG_TRACE
+        dmg_processor_trace(dmg);
+#endif /* DMG_TRACE */
+        INSTRUCTION[dmg_processor_decode(dmg)](dmg);
     }
-    dmg->processor.af.half_carry = false;
-    dmg->processor.af.negative = false;
-}
-
-static void dmg_processor_instruction_rlca(dmg_t const dmg)
-{
-    dmg->processor.delay = 4;
-    dmg->processor.af.carry = ((dmg->processor.af.high & 0x80) == 0x80);
-    dmg->processor.af.high = (dmg->processor.af.high << 1) | dmg->processor.af.carry;
-    dmg->processor.af.half_carry = false;
-    dmg->processor.af.negative = false;
-    dmg->processor.af.zero = false;
 }
 
-static void dmg_processor_instruction_rr(dmg_t const dmg)
+static void dmg_processor_service(dmg_t const dmg)
 {
-    uint8_t carry = dmg->processor.af.carry, operand = 0;
-    dmg->processor.delay = 8;
-    switch (dmg->processor.instruction.opcode)
+    dmg_interrupt_e interrupt;
+    for (interrupt = 0; interrupt < DMG_INTERRUPT_MAX; ++interrupt)
     {
-        case 0x18: /* B */
-            dmg->processor.af.carry = dmg->processor.bc.high & 1;
-            dmg->processor.bc.high = (dmg->processor.bc.high >> 1) | (carry ? 0x80 : 0);
-            dmg->processor.af.zero = !dmg->processor.bc.high;
-            break;
-        case 0x19: /* C */
-            dmg->processor.af.carry = dmg->processor.bc.low & 1;
-            dmg->processor.bc.low = (dmg->processor.bc.low >> 1) | (carry ? 0x80 : 0);
-            dmg->processor.af.zero = !dmg->processor.bc.low;
-            break;
-        case 0x1A: /* D */
-            dmg->processor.af.carry = dmg->processor.de.high & 1;
-            dmg->processor.de.high = (dmg->processor.de.high >> 1) | (carry ? 0x80 : 0);
-            dmg->processor.af.zero = !dmg->processor.de.high;
-            break;
-        case 0x1B: /* E */
-            dmg->processor.af.carry = dmg->processor.de.low & 1;
-            dmg->processor.de.low = (dmg->processor.de.low >> 1) | (carry ? 0x80 : 0);
-            dmg->processor.af.zero = !dmg->processor.de.low;
-            break;
-        case 0x1C: /* H */
-            dmg->processor.af.carry = dmg->processor.hl.high & 1;
-            dmg->processor.hl.high = (dmg->processor.hl.high >> 1) | (carry ? 0x80 : 0);
-            dmg->processor.af.zero = !dmg->processor.hl.high;
-            break;
-        case 0x1D: /* L */
-            dmg->processor.af.carry = dmg->processor.hl.low & 1;
-            dmg->processor.hl.low = (dmg->processor.hl.low >> 1) | (carry ? 0x80 : 0);
-            dmg->processor.af.zero = !dmg->processor.hl.low;
-            break;
-        case 0x1E: /* (HL) */
-            dmg->processor.delay += 8;
-            operand = dmg_system_read(dmg, dmg->processor.hl.word);
-            dmg->processor.af.carry = operand & 1;
-            operand = (operand >> 1) | (carry ? 0x80 : 0);
-            dmg->processor.af.zero = !operand;
-            dmg_system_write(dmg, dmg->processor.hl.word, operand);
-            break;
-        case 0x1F: /* A */
-            dmg->processor.af.carry = dmg->processor.af.high & 1;
-            dmg->processor.af.high = (dmg->processor.af.high >> 1) | (carry ? 0x80 : 0);
-            dmg->processor.af.zero = !dmg->processor.af.high;
+        uint8_t mask = 1 << interrupt;
+        if (dmg->processor.interrupt.enable & dmg->processor.interrupt.flag & mask)
+        {
+            dmg->processor.sp.word -= 2;
+            dmg_system_write_word(dmg, dmg->processor.sp.word, dmg->processor.pc.word);
+            dmg->processor.pc.word = (0x0008 * interrupt) + 0x0040;
+            dmg->processor.interrupt.enabled = false;
+            dmg->processor.interrupt.flag &= ~mask;
+            dmg->processor.delay = 20;
             break;
+        }
     }
-    dmg->processor.af.half_carry = false;
-    dmg->processor.af.negative = false;
 }
 
-static void dmg_processor_instruction_rra(dmg_t const dmg)
+static uint8_t dmg_processor_wait(dmg_t const dmg)
 {
-    uint8_t carry = dmg->processor.af.carry;
-    dmg->processor.delay = 4;
-    dmg->processor.af.carry = ((dmg->processor.af.high & 1) == 1);
-    dmg->processor.af.high = (dmg->processor.af.high >> 1) | (carry ? 0x80 : 0);
-    dmg->processor.af.half_carry = false;
-    dmg->processor.af.negative = false;
-    dmg->processor.af.zero = false;
+    uint8_t result = 4;
+    uint64_t cycle = dmg_system_deadline(dmg);
+    if (!dmg->processor.interrupt.enable_delay && (cycle > (dmg->scheduler.cycle + result)))
+    { /* SKIP TO THE STEP THAT REACHES THE NEXT EVENT */
+        cycle = (cycle - dmg->scheduler.cycle + 3) & ~3;
+        result = (cycle < 0xFC) ? cycle : 0xFC;
+    }
+    return result;
 }
 
-static void dmg_processor_instruction_rrc(dmg_t const dmg)
+uint8_t dmg_processor_disassemble(dmg_t const dmg, uint16_t address, char *const buffer, uint32_t length)
 {
-    uint8_t operand = 0;
-    dmg->processor.delay = 8;
-    switch (dmg->processor.instruction.opcode)
+    uint32_t offset = 0;
+    dmg_decode_t decode = {};
+    dmg_processor_fetch(dmg, address, &decode);
+    for (const char *mnemonic = OPCODE[decode.index].mnemonic; *mnemonic && ((offset + 1) < length); ++mnemonic)
     {
-        case 0x08: /* B */
-            dmg->processor.af.carry = dmg->processor.bc.high & 1;
-            dmg->processor.bc.high = (dmg->processor.bc.high >> 1) | (dmg->processor.af.carry ? 0x80 : 0);
-            dmg->processor.af.zero = !dmg->processor.bc.high;
-            break;
-        case 0x09: /* C */
-            dmg->processor.af.carry = dmg->processor.bc.low & 1;
-            dmg->processor.bc.low = (dmg->processor.bc.low >> 1) | (dmg->processor.af.carry ? 0x80 : 0);
-            dmg->processor.af.zero = !dmg->processor.bc.low;
-            break;
-        case 0x0A: /* D */
-            dmg->processor.af.carry = dmg->processor.de.high & 1;
-            dmg->processor.de.high = (dmg->processor.de.high >> 1) | (dmg->processor.af.carry ? 0x80 : 0);
-            dmg->processor.af.zero = !dmg->processor.de.high;
-            break;
-        case 0x0B: /* E */
-            dmg->processor.af.carry = dmg->processor.de.low & 1;
-            dmg->processor.de.low = (dmg->processor.de.low >> 1) | (dmg->processor.af.carry ? 0x80 : 0);
-            dmg->processor.af.zero = !dmg->processor.de.low;
-            break;
-        case 0x0C: /* H */
-            dmg->processor.af.carry = dmg->processor.hl.high & 1;
-            dmg->processor.hl.high = (dmg->processor.hl.high >> 1) | (dmg->processor.af.carry ? 0x80 : 0);
-            dmg->processor.af.zero = !dmg->processor.hl.high;
-            break;
-        case 0x0D: /* L */
-            dmg->processor.af.carry = dmg->processor.hl.low & 1;
-            dmg->processor.hl.low = (dmg->processor.hl.low >> 1) | (dmg->processor.af.carry ? 0x80 : 0);
-            dmg->processor.af.zero = !dmg->processor.hl.low;
-            break;
-        case 0x0E: /* (HL) */
-            dmg->processor.delay += 8;
-            operand = dmg_system_read(dmg, dmg->processor.hl.word);
-            dmg->processor.af.carry = operand & 1;
-            operand = (operand >> 1) | (dmg->processor.af.carry ? 0x80 : 0);
-            dmg->processor.af.zero = !operand;
-            dmg_system_write(dmg, dmg->processor.hl.word, operand);
-            break;
-        case 0x0F: /* A */
-            dmg->processor.af.carry = dmg->processor.af.high & 1;
-            dmg->processor.af.high = (dmg->processor.af.high >> 1) | (dmg->processor.af.carry ? 0x80 : 0);
-            dmg->processor.af.zero = !dmg->processor.af.high;
-            break;
+        int count = 1;
+        if (!strncmp(mnemonic, "a16", 3) || !strncmp(mnemonic, "n16", 3))
+        { /* 16-BIT ADDRESS/IMMEDIATE */
+            count = snprintf(&buffer[offset], length - offset, "$%04X", decode.operand.word);
+            mnemonic += 2;
+        }
+        else if (!strncmp(mnemonic, "a8", 2))
+        { /* 8-BIT HIGH ADDRESS */
+            count = snprintf(&buffer[offset], length - offset, "$FF%02X", decode.operand.low);
+            ++mnemonic;
+        }
+        else if (!strncmp(mnemonic, "e8", 2))
+        { /* 8-BIT SIGNED OFFSET */
+            count = snprintf(&buffer[offset], length - offset, "%d", (int8_t)decode.operand.low);
+            ++mnemonic;
+        }
+        else if (!strncmp(mnemonic, "n8", 2))
+        { /* 8-BIT IMMEDIATE */
+            count = snprintf(&buffer[offset], length - offset, "$%02X", decode.operand.low);
+            ++mnemonic;
+        }
+        else
+        {
+            buffer[offset] = *mnemonic;
+        }
+        offset = ((offset + count) < length) ? offset + count : length - 1;
     }
-    dmg->processor.af.half_carry = false;
-    dmg->processor.af.negative = false;
-}
-
-static void dmg_processor_instruction_rrca(dmg_t const dmg)
-{
-    dmg->processor.delay = 4;
-    dmg->processor.af.carry = ((dmg->processor.af.high & 1) == 1);
-    dmg->processor.af.high = (dmg->processor.af.high >> 1) | (dmg->processor.af.carry ? 0x80 : 0);
-    dmg->processor.af.half_carry = false;
-    dmg->processor.af.negative = false;
-    dmg->processor.af.zero = false;
+    buffer[offset] = '\0';
+    return decode.length;
 }
 
-static void dmg_processor_instruction_rst(dmg_t const dmg)
+dmg_error_e dmg_processor_initialize(dmg_t const dmg)
 {
-    dmg->processor.delay = 16;
-    dmg_system_write(dmg, --dmg->processor.sp.word, dmg->processor.pc.high);
-    dmg_system_write(dmg, --dmg->processor.sp.word, dmg->processor.pc.low);
-    dmg->processor.pc.word = dmg->processor.instruction.opcode - 0xC7;
-}
-
-static void dmg_processor_instruction_sbc(dmg_t const dmg)
-{
-    uint16_t sum;
-    uint8_t carry, operand = 0;
-    dmg->processor.delay = 4;
-    switch (dmg->processor.instruction.opcode)
-    {
-        case 0x98: /* B */
-            operand = dmg->processor.bc.high;
-            break;
-        case 0x99: /* C */
-            operand = dmg->processor.bc.low;
-            break;
-        case 0x9A: /* D */
-            operand = dmg->processor.de.high;
-            break;
-        case 0x9B: /* E */
-            operand = dmg->processor.de.low;
-            break;
-        case 0x9C: /* H */
-            operand = dmg->processor.hl.high;
-            break;
-        case 0x9D: /* L */
-            operand = dmg->processor.hl.low;
-            break;
-        case 0x9E: /* (HL) */
-            dmg->processor.delay += 4;
-            operand = dmg_system_read(dmg, dmg->processor.hl.word);
-            break;
-        case 0x9F: /* A */
-            operand = dmg->processor.af.high;
-            break;
-        case 0xDE: /* # */
-            dmg->processor.delay += 4;
-            operand = dmg_system_read(dmg, dmg->processor.pc.word++);
-            break;
+    dmg_error_e result = DMG_SUCCESS;
+    for (uint16_t index = 0; index < 0x800; ++index)
+    { /* DAA (A,CARRY,HALF-CARRY,NEGATIVE) */
+        bool carry = index & 0x100, half_carry = index & 0x200, negative = index & 0x400;
+        uint8_t adjust = 0, value = index;
+        if (half_carry || (!negative && ((value & 0x0F) > 0x09)))
+        {
+            adjust |= 0x06;
+        }
+        if (carry || (!negative && (value > 0x99)))
+        {
+            adjust |= 0x60;
+            carry = true;
+        }
+        value = negative ? value - adjust : value + adjust;
+        dmg->processor.table.daa[index] = (value << 8) | (!value << 7) | (negative << 6) | (carry << 4);
     }
-    carry = dmg->processor.af.carry;
-    sum = dmg->processor.af.high - operand - carry;
-    dmg->processor.af.carry = ((int16_t)sum < 0);
-    dmg->processor.af.half_carry = ((int16_t)((dmg->processor.af.high & 0x0F) - (operand & 0x0F) - carry) < 0);
-    dmg->processor.af.negative = true;
-    dmg->processor.af.zero = !(sum & 0xFF);
-    dmg->processor.af.high = sum;
+    for (uint16_t index = 0; index < (DMG_FLAG_MAX << 5); ++index)
+    { /* FLAG (OPERATION,HALF-CARRY,LOW NIBBLE) */
+        uint8_t value = 0;
+        switch (index >> 5)
+        {
+            case DMG_FLAG_ADD:
+                value = (index & 0x10) << 1;
+                break;
+            case DMG_FLAG_AND:
+            case DMG_FLAG_BIT:
+                value = 0x20;
+                break;
+            case DMG_FLAG_DEC:
+                value = 0x40 | (((index & 0x0F) == 0x0F) << 5);
+                break;
+            case DMG_FLAG_INC:
+                value = !(index & 0x0F) << 5;
+                break;
+            case DMG_FLAG_SUB:
+                value = 0x40 | ((index & 0x10) << 1);
+                break;
+            default:
+                break;
+        }
+        dmg->processor.table.flag[index] = value;
+    }
+#ifdef DMG_ALU_VERIFY
+    dmg_flag_e operation = dmg->processor.flag.operation;
+    dmg_register_t af = dmg->processor.af;
+    uint16_t flag_result = dmg->processor.flag.result;
+    uint8_t operand = dmg->processor.flag.operand;
+    for (uint16_t index = 0; (result == DMG_SUCCESS) && (index < 0x800); ++index)
+    { /* VERIFY DAA TABLE AGAINST ARITHMETIC */
+        dmg->processor.af.high = index;
+        dmg->processor.af.low = (index >> 4) & 0x70;
+        dmg_processor_daa_arithmetic(dmg);
+        if (dmg->processor.af.word != dmg->processor.table.daa[index])
+        {
+            result = DMG_ERROR(dmg, "DAA table mismatch -- [%03X] %04X (expected %04X)", index, dmg->processor.table.daa[index], dmg->processor.af.word);
+        }
+    }
+    for (uint16_t index = 0; (result == DMG_SUCCESS) && (index < (DMG_FLAG_MAX << 5)); ++index)
+    { /* VERIFY FLAG TABLE AGAINST ARITHMETIC */
+        dmg->processor.af.low = 0;
+        dmg->processor.flag.operation = index >> 5;
+        dmg->processor.flag.operand = index & 0x10;
+        dmg->processor.flag.result = index & 0x0F;
+        dmg_processor_flags_arithmetic(dmg);
+        if (dmg->processor.af.low != dmg->processor.table.flag[index])
+        {
+            result = DMG_ERROR(dmg, "Flag table mismatch -- [%03X] %02X (expected %02X)", index, dmg->processor.table.flag[index], dmg->processor.af.low);
+        }
+    }
+    dmg->processor.af = af;
+    dmg->processor.flag.operand = operand;
+    dmg->processor.flag.operation = operation;
+    dmg->processor.flag.result = flag_result;
+#endif /* DMG_ALU_VERIFY */
+    return result;
 }
 
-static void dmg_processor_instruction_scf(dmg_t const dmg)
+void dmg_processor_interrupt(dmg_t const dmg, dmg_interrupt_e interrupt)
 {
-    dmg->processor.delay = 4;
-    dmg->processor.af.carry = true;
-    dmg->processor.af.half_carry = false;
-    dmg->processor.af.negative = false;
+    dmg_processor_write(dmg, 0xFF0F, dmg->processor.interrupt.flag | (1 << interrupt));
 }
 
-static void dmg_processor_instruction_set(dmg_t const dmg)
+void dmg_processor_invalidate(dmg_t const dmg)
 {
-    dmg->processor.delay = 8;
-    switch (dmg->processor.instruction.opcode)
+    uint16_t bank[] = { dmg_mapper_bank(dmg, 0x0000), dmg_mapper_bank(dmg, 0x4000) };
+    for (uint16_t page = 0; page < 0x80; ++page)
     {
-        case 0xC0: case 0xC8: case 0xD0: case 0xD8:
-        case 0xE0: case 0xE8: case 0xF0: case 0xF8: /* B */
-            dmg->processor.bc.high |= (1 << ((dmg->processor.instruction.opcode - 0xC0) / 8));
-            break;
-        case 0xC1: case 0xC9: case 0xD1: case 0xD9:
-        case 0xE1: case 0xE9: case 0xF1: case 0xF9: /* C */
-            dmg->processor.bc.low |= (1 << ((dmg->processor.instruction.opcode - 0xC1) / 8));
-            break;
-        case 0xC2: case 0xCA: case 0xD2: case 0xDA:
-        case 0xE2: case 0xEA: case 0xF2: case 0xFA: /* D */
-            dmg->processor.de.high |= (1 << ((dmg->processor.instruction.opcode - 0xC2) / 8));
-            break;
-        case 0xC3: case 0xCB: case 0xD3: case 0xDB:
-        case 0xE3: case 0xEB: case 0xF3: case 0xFB: /* E */
-            dmg->processor.de.low |= (1 << ((dmg->processor.instruction.opcode - 0xC3) / 8));
-            break;
-        case 0xC4: case 0xCC: case 0xD4: case 0xDC:
-        case 0xE4: case 0xEC: case 0xF4: case 0xFC: /* H */
-            dmg->processor.hl.high |= (1 << ((dmg->processor.instruction.opcode - 0xC4) / 8));
-            break;
-        case 0xC5: case 0xCD: case 0xD5: case 0xDD:
-        case 0xE5: case 0xED: case 0xF5: case 0xFD: /* L */
-            dmg->processor.hl.low |= (1 << ((dmg->processor.instruction.opcode - 0xC5) / 8));
-            break;
-        case 0xC6: case 0xCE: case 0xD6: case 0xDE:
-        case 0xE6: case 0xEE: case 0xF6: case 0xFE: /* (HL) */
-            dmg->processor.delay += 8;
-            dmg_system_write(dmg, dmg->processor.hl.word, dmg_system_read(dmg, dmg->processor.hl.word)
-                | (1 << ((dmg->processor.instruction.opcode - 0xC6) / 8)));
-            break;
-        case 0xC7: case 0xCF: case 0xD7: case 0xDF:
-        case 0xE7: case 0xEF: case 0xF7: case 0xFF: /* A */
-            dmg->processor.af.high |= (1 << ((dmg->processor.instruction.opcode - 0xC7) / 8));
-            break;
+        dmg->processor.cache.bank[page] = bank[(page < 0x40) ? 0 : 1];
     }
-}
-
-static void dmg_processor_instruction_sla(dmg_t const dmg)
-{
-    uint8_t operand = 0;
-    dmg->processor.delay = 8;
-    switch (dmg->processor.instruction.opcode)
+    if (dmg_bootloader_enabled(dmg))
     {
-        case 0x20: /* B */
-            dmg->processor.af.carry = ((dmg->processor.bc.high & 0x80) == 0x80);
-            dmg->processor.bc.high <<= 1;
-            dmg->processor.af.zero = !dmg->processor.bc.high;
-            break;
-        case 0x21: /* C */
-            dmg->processor.af.carry = ((dmg->processor.bc.low & 0x80) == 0x80);
-            dmg->processor.bc.low <<= 1;
-            dmg->processor.af.zero = !dmg->processor.bc.low;
-            break;
-        case 0x22: /* D */
-            dmg->processor.af.carry = ((dmg->processor.de.high & 0x80) == 0x80);
-            dmg->processor.de.high <<= 1;
-            dmg->processor.af.zero = !dmg->processor.de.high;
-            break;
-        case 0x23: /* E */
-            dmg->processor.af.carry = ((dmg->processor.de.low & 0x80) == 0x80);
-            dmg->processor.de.low <<= 1;
-            dmg->processor.af.zero = !dmg->processor.de.low;
-            break;
-        case 0x24: /* H */
-            dmg->processor.af.carry = ((dmg->processor.hl.high & 0x80) == 0x80);
-            dmg->processor.hl.high <<= 1;
-            dmg->processor.af.zero = !dmg->processor.hl.high;
-            break;
-        case 0x25: /* L */
-            dmg->processor.af.carry = ((dmg->processor.hl.low & 0x80) == 0x80);
-            dmg->processor.hl.low <<= 1;
-            dmg->processor.af.zero = !dmg->processor.hl.low;
-            break;
-        case 0x26: /* (HL) */
-            dmg->processor.delay += 8;
-            operand = dmg_system_read(dmg, dmg->processor.hl.word);
-            dmg->processor.af.carry = ((operand & 0x80) == 0x80);
-            operand <<= 1;
-            dmg->processor.af.zero = !operand;
-            dmg_system_write(dmg, dmg->processor.hl.word, operand);
-            break;
-        case 0x27: /* A */
-            dmg->processor.af.carry = ((dmg->processor.af.high & 0x80) == 0x80);
-            dmg->processor.af.high <<= 1;
-            dmg->processor.af.zero = !dmg->processor.af.high;
-            break;
+        dmg->processor.cache.bank[0] = 0xFFFF; /* BOOTLOADER */
     }
-    dmg->processor.af.half_carry = false;
-    dmg->processor.af.negative = false;
 }
 
-static void dmg_processor_instruction_sra(dmg_t const dmg)
+dmg_error_e dmg_processor_jit(dmg_t const dmg)
 {
-    uint8_t operand = 0;
-    dmg->processor.delay = 8;
-    switch (dmg->processor.instruction.opcode)
+#ifdef DMG_JIT
+    if (dmg->processor.jit.block)
     {
-        case 0x28: /* B */
-            dmg->processor.af.carry = dmg->processor.bc.high & 1;
-            dmg->processor.bc.high = (dmg->processor.bc.high >> 1) | (dmg->processor.bc.high & 0x80);
-            dmg->processor.af.zero = !dmg->processor.bc.high;
-            break;
-        case 0x29: /* C */
-            dmg->processor.af.carry = dmg->processor.bc.low & 1;
-            dmg->processor.bc.low = (dmg->processor.bc.low >> 1) | (dmg->processor.bc.low & 0x80);
-            dmg->processor.af.zero = !dmg->processor.bc.low;
-            break;
-        case 0x2A: /* D */
-            dmg->processor.af.carry = dmg->processor.de.high & 1;
-            dmg->processor.de.high = (dmg->processor.de.high >> 1) | (dmg->processor.de.high & 0x80);
-            dmg->processor.af.zero = !dmg->processor.de.high;
-            break;
-        case 0x2B: /* E */
-            dmg->processor.af.carry = dmg->processor.de.low & 1;
-            dmg->processor.de.low = (dmg->processor.de.low >> 1) | (dmg->processor.de.low & 0x80);
-            dmg->processor.af.zero = !dmg->processor.de.low;
-            break;
-        case 0x2C: /* H */
-            dmg->processor.af.carry = dmg->processor.hl.high & 1;
-            dmg->processor.hl.high = (dmg->processor.hl.high >> 1) | (dmg->processor.hl.high & 0x80);
-            dmg->processor.af.zero = !dmg->processor.hl.high;
-            break;
-        case 0x2D: /* L */
-            dmg->processor.af.carry = dmg->processor.hl.low & 1;
-            dmg->processor.hl.low = (dmg->processor.hl.low >> 1) | (dmg->processor.hl.low & 0x80);
-            dmg->processor.af.zero = !dmg->processor.hl.low;
-            break;
-        case 0x2E: /* (HL) */
-            dmg->processor.delay += 8;
-            operand = dmg_system_read(dmg, dmg->processor.hl.word);
-            dmg->processor.af.carry = operand & 1;
-            operand = (operand >> 1) | (operand & 0x80);
-            dmg->processor.af.zero = !operand;
-            dmg_system_write(dmg, dmg->processor.hl.word, operand);
-            break;
-        case 0x2F: /* A */
-            dmg->processor.af.carry = dmg->processor.af.high & 1;
-            dmg->processor.af.high = (dmg->processor.af.high >> 1) | (dmg->processor.af.high & 0x80);
-            dmg->processor.af.zero = !dmg->processor.af.high;
-            break;
+        return DMG_SUCCESS;
     }
-    dmg->processor.af.half_carry = false;
-    dmg->processor.af.negative = false;
-}
-
-static void dmg_processor_instruction_srl(dmg_t const dmg)
-{
-    uint8_t operand = 0;
-    dmg->processor.delay = 8;
-    switch (dmg->processor.instruction.opcode)
+    if ((dmg->processor.jit.arena = mmap(NULL, DMG_JIT_ARENA, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0)) == MAP_FAILED)
     {
-        case 0x38: /* B */
-            dmg->processor.af.carry = dmg->processor.bc.high & 1;
-            dmg->processor.bc.high >>= 1;
-            dmg->processor.af.zero = !dmg->processor.bc.high;
-            break;
-        case 0x39: /* C */
-            dmg->processor.af.carry = dmg->processor.bc.low & 1;
-            dmg->processor.bc.low >>= 1;
-            dmg->processor.af.zero = !dmg->processor.bc.low;
-            break;
-        case 0x3A: /* D */
-            dmg->processor.af.carry = dmg->processor.de.high & 1;
-            dmg->processor.de.high >>= 1;
-            dmg->processor.af.zero = !dmg->processor.de.high;
-            break;
-        case 0x3B: /* E */
-            dmg->processor.af.carry = dmg->processor.de.low & 1;
-            dmg->processor.de.low >>= 1;
-            dmg->processor.af.zero = !dmg->processor.de.low;
-            break;
-        case 0x3C: /* H */
-            dmg->processor.af.carry = dmg->processor.hl.high & 1;
-            dmg->processor.hl.high >>= 1;
-            dmg->processor.af.zero = !dmg->processor.hl.high;
-            break;
-        case 0x3D: /* L */
-            dmg->processor.af.carry = dmg->processor.hl.low & 1;
-            dmg->processor.hl.low >>= 1;
-            dmg->processor.af.zero = !dmg->processor.hl.low;
-            break;
-        case 0x3E: /* (HL) */
-            dmg->processor.delay += 8;
-            operand = dmg_system_read(dmg, dmg->processor.hl.word);
-            dmg->processor.af.carry = operand & 1;
-            operand >>= 1;
-            dmg->processor.af.zero = !operand;
-            dmg_system_write(dmg, dmg->processor.hl.word, operand);
-            break;
-        case 0x3F: /* A */
-            dmg->processor.af.carry = dmg->processor.af.high & 1;
-            dmg->processor.af.high >>= 1;
-            dmg->processor.af.zero = !dmg->processor.af.high;
-            break;
+        dmg->processor.jit.arena = NULL;
+        return DMG_ERROR(dmg, "Failed to map JIT arena -- %u bytes", DMG_JIT_ARENA);
     }
-    dmg->processor.af.half_carry = false;
-    dmg->processor.af.negative = false;
-}
-
-static void dmg_processor_instruction_stop(dmg_t const dmg)
-{
-    dmg->processor.delay = 4;
-    dmg->processor.stopped = true;
-    dmg_system_read(dmg, dmg->processor.pc.word++);
-}
-
-static void dmg_processor_instruction_sub(dmg_t const dmg)
-{
-    uint8_t operand = 0;
-    uint16_t carry, sum;
-    dmg->processor.delay = 4;
-    switch (dmg->processor.instruction.opcode)
+    if (!(dmg->processor.jit.block = calloc(0x8000, sizeof (*dmg->processor.jit.block))))
     {
-        case 0x90: /* B */
-            operand = dmg->processor.bc.high;
-            break;
-        case 0x91: /* C */
-            operand = dmg->processor.bc.low;
-            break;
-        case 0x92: /* D */
-            operand = dmg->processor.de.high;
-            break;
-        case 0x93: /* E */
-            operand = dmg->processor.de.low;
-            break;
-        case 0x94: /* H */
-            operand = dmg->processor.hl.high;
-            break;
-        case 0x95: /* L */
-            operand = dmg->processor.hl.low;
-            break;
-        case 0x96: /* (HL) */
-            dmg->processor.delay += 4;
-            operand = dmg_system_read(dmg, dmg->processor.hl.word);
-            break;
-        case 0x97: /* A */
-            operand = dmg->processor.af.high;
-            break;
-        case 0xD6: /* # */
-            dmg->processor.delay += 4;
-            operand = dmg_system_read(dmg, dmg->processor.pc.word++);
-            break;
+        munmap(dmg->processor.jit.arena, DMG_JIT_ARENA);
+        dmg->processor.jit.arena = NULL;
+        return DMG_ERROR(dmg, "Failed to allocate JIT blocks -- %u entries", 0x8000);
     }
-    sum = dmg->processor.af.high - operand;
-    carry = dmg->processor.af.high ^ operand ^ sum;
-    dmg->processor.af.carry = ((carry & 0x100) == 0x100);
-    dmg->processor.af.half_carry = ((carry & 0x10) == 0x10);
-    dmg->processor.af.negative = true;
-    dmg->processor.af.zero = !(sum & 0xFF);
-    dmg->processor.af.high = sum;
+    return DMG_SUCCESS;
+#else
+    return DMG_ERROR(dmg, "Unsupported JIT platform");
+#endif /* DMG_JIT */
 }
 
-static void dmg_processor_instruction_swap(dmg_t const dmg)
+uint8_t dmg_processor_read(dmg_t const dmg, uint16_t address)
 {
-    uint8_t operand = 0;
-    dmg->processor.delay = 8;
-    switch (dmg->processor.instruction.opcode)
+    uint8_t result = 0xFF;
+    switch (address)
     {
-        case 0x30: /* B */
-            dmg->processor.bc.high = (dmg->processor.bc.high << 4) | (dmg->processor.bc.high >> 4);
-            dmg->processor.af.zero = !dmg->processor.bc.high;
-            break;
-        case 0x31: /* C */
-            dmg->processor.bc.low = (dmg->processor.bc.low << 4) | (dmg->processor.bc.low >> 4);
-            dmg->processor.af.zero = !dmg->processor.bc.low;
-            break;
-        case 0x32: /* D */
-            dmg->processor.de.high = (dmg->processor.de.high << 4) | (dmg->processor.de.high >> 4);
-            dmg->processor.af.zero = !dmg->processor.de.high;
-            break;
-        case 0x33: /* E */
-            dmg->processor.de.low = (dmg->processor.de.low << 4) | (dmg->processor.de.low >> 4);
-            dmg->processor.af.zero = !dmg->processor.de.low;
-            break;
-        case 0x34: /* H */
-            dmg->processor.hl.high = (dmg->processor.hl.high << 4) | (dmg->processor.hl.high >> 4);
-            dmg->processor.af.zero = !dmg->processor.hl.high;
-            break;
-        case 0x35: /* L */
-            dmg->processor.hl.low = (dmg->processor.hl.low << 4) | (dmg->processor.hl.low >> 4);
-            dmg->processor.af.zero = !dmg->processor.hl.low;
+        case 0xFF0F: /* IF */
+            result = dmg->processor.interrupt.flag;
             break;
-        case 0x36: /* (HL) */
-            dmg->processor.delay += 8;
-            operand = dmg_system_read(dmg, dmg->processor.hl.word);
-            operand = (operand << 4) | (operand >> 4);
-            dmg->processor.af.zero = !operand;
-            dmg_system_write(dmg, dmg->processor.hl.word, operand);
+        case 0xFFFF: /* IE */
+            result = dmg->processor.interrupt.enable;
             break;
-        case 0x37: /* A */
-            dmg->processor.af.high = (dmg->processor.af.high << 4) | (dmg->processor.af.high >> 4);
-            dmg->processor.af.zero = !dmg->processor.af.high;
+        default:
             break;
     }
-    dmg->processor.af.carry = false;
-    dmg->processor.af.half_carry = false;
-    dmg->processor.af.negative = false;
+    return result;
 }
 
-static void dmg_processor_instruction_xor(dmg_t const dmg)
+#ifdef DMG_THREADED
+uint8_t dmg_processor_run(dmg_t const dmg)
 {
-    dmg->processor.delay = 4;
-    switch (dmg->processor.instruction.opcode)
+    static const void *const LABEL[] =
     {
-        case 0xA8: /* B */
-            dmg->processor.af.high ^= dmg->processor.bc.high;
-            break;
-        case 0xA9: /* C */
-            dmg->processor.af.high ^= dmg->processor.bc.low;
-            break;
-        case 0xAA: /* D */
-            dmg->processor.af.high ^= dmg->processor.de.high;
-            break;
-        case 0xAB: /* E */
-            dmg->processor.af.high ^= dmg->processor.de.low;
-            break;
-        case 0xAC: /* H */
-            dmg->processor.af.high ^= dmg->processor.hl.high;
-            break;
-        case 0xAD: /* L */
-            dmg->processor.af.high ^= dmg->processor.hl.low;
-            break;
-        case 0xAE: /* (HL) */
-            dmg->processor.delay += 4;
-            dmg->processor.af.high ^= dmg_system_read(dmg, dmg->processor.hl.word);
-            break;
-        case 0xAF: /* A */
-            dmg->processor.af.high = 0;
-            break;
-        case 0xEE: /* # */
-            dmg->processor.delay += 4;
-            dmg->processor.af.high ^= dmg_system_read(dmg, dmg->processor.pc.word++);
-            break;
-    }
-    dmg->processor.af.carry = false;
-    dmg->processor.af.half_carry = false;
-    dmg->processor.af.negative = false;
-    dmg->processor.af.zero = !dmg->processor.af.high;
-}
-
-static void dmg_processor_instruction_xxx(dmg_t const dmg)
-{
-#ifndef NDEBUG
-    fprintf(stderr, "Invalid opcode -- [%04X] %02X", dmg->processor.instruction.address, dmg->processor.instruction.opcode);
-#endif /* NDEBUG */
-}
-
-static const dmg_instruction_f INSTRUCTION[] =
-{
-    /* 00 */
-    dmg_processor_instruction_nop, dmg_processor_instruction_ld, dmg_processor_instruction_ld, dmg_processor_instruction_inc_word,
-    dmg_processor_instruction_inc, dmg_processor_instruction_dec, dmg_processor_instruction_ld, dmg_processor_instruction_rlca,
-    /* 08 */
-    dmg_processor_instruction_ld, dmg_processor_instruction_add_hl, dmg_processor_instruction_ld, dmg_processor_instruction_dec_word,
-    dmg_processor_instruction_inc, dmg_processor_instruction_dec, dmg_processor_instruction_ld, dmg_processor_instruction_rrca,
-    /* 10 */
-    dmg_processor_instruction_stop, dmg_processor_instruction_ld, dmg_processor_instruction_ld, dmg_processor_instruction_inc_word,
-    dmg_processor_instruction_inc, dmg_processor_instruction_dec, dmg_processor_instruction_ld, dmg_processor_instruction_rla,
-    /* 18 */
-    dmg_processor_instruction_jr, dmg_processor_instruction_add_hl, dmg_processor_instruction_ld, dmg_processor_instruction_dec_word,
-    dmg_processor_instruction_inc, dmg_processor_instruction_dec, dmg_processor_instruction_ld, dmg_processor_instruction_rra,
-    /* 20 */
-    dmg_processor_instruction_jr, dmg_processor_instruction_ld, dmg_processor_instruction_ld, dmg_processor_instruction_inc_word,
-    dmg_processor_instruction_inc, dmg_processor_instruction_dec, dmg_processor_instruction_ld, dmg_processor_instruction_daa,
-    /* 28 */
-    dmg_processor_instruction_jr, dmg_processor_instruction_add_hl, dmg_processor_instruction_ld, dmg_processor_instruction_dec_word,
-    dmg_processor_instruction_inc, dmg_processor_instruction_dec, dmg_processor_instruction_ld, dmg_processor_instruction_cpl,
-    /* 30 */
-    dmg_processor_instruction_jr, dmg_processor_instruction_ld, dmg_processor_instruction_ld, dmg_processor_instruction_inc_word,
-    dmg_processor_instruction_inc, dmg_processor_instruction_dec, dmg_processor_instruction_ld, dmg_processor_instruction_scf,
-    /* 38 */
-    dmg_processor_instruction_jr, dmg_processor_instruction_add_hl, dmg_processor_instruction_ld, dmg_processor_instruction_dec_word,
-    dmg_processor_instruction_inc, dmg_processor_instruction_dec, dmg_processor_instruction_ld, dmg_processor_instruction_ccf,
-    /* 40 */
-    dmg_processor_instruction_ld, dmg_processor_instruction_ld, dmg_processor_instruction_ld, dmg_processor_instruction_ld,
-    dmg_processor_instruction_ld, dmg_processor_instruction_ld, dmg_processor_instruction_ld, dmg_processor_instruction_ld,
-    /* 48 */
-    dmg_processor_instruction_ld, dmg_processor_instruction_ld, dmg_processor_instruction_ld, dmg_processor_instruction_ld,
-    dmg_processor_instruction_ld, dmg_processor_instruction_ld, dmg_processor_instruction_ld, dmg_processor_instruction_ld,
-    /* 50 */
-    dmg_processor_instruction_ld, dmg_processor_instruction_ld, dmg_processor_instruction_ld, dmg_processor_instruction_ld,
-    dmg_processor_instruction_ld, dmg_processor_instruction_ld, dmg_processor_instruction_ld, dmg_processor_instruction_ld,
-    /* 58 */
-    dmg_processor_instruction_ld, dmg_processor_instruction_ld, dmg_processor_instruction_ld, dmg_processor_instruction_ld,
-    dmg_processor_instruction_ld, dmg_processor_instruction_ld, dmg_processor_instruction_ld, dmg_processor_instruction_ld,
-    /* 60 */
-    dmg_processor_instruction_ld, dmg_processor_instruction_ld, dmg_processor_instruction_ld, dmg_processor_instruction_ld,
-    dmg_processor_instruction_ld, dmg_processor_instruction_ld, dmg_processor_instruction_ld, dmg_processor_instruction_ld,
-    /* 68 */
-    dmg_processor_instruction_ld, dmg_processor_instruction_ld, dmg_processor_instruction_ld, dmg_processor_instruction_ld,
-    dmg_processor_instruction_ld, dmg_processor_instruction_ld, dmg_processor_instruction_ld, dmg_processor_instruction_ld,
-    /* 70 */
-    dmg_processor_instruction_ld, dmg_processor_instruction_ld, dmg_processor_instruction_ld, dmg_processor_instruction_ld,
-    dmg_processor_instruction_ld, dmg_processor_instruction_ld, dmg_processor_instruction_halt, dmg_processor_instruction_ld,
-    /* 78 */
-    dmg_processor_instruction_ld, dmg_processor_instruction_ld, dmg_processor_instruction_ld, dmg_processor_instruction_ld,
-    dmg_processor_instruction_ld, dmg_processor_instruction_ld, dmg_processor_instruction_ld, dmg_processor_instruction_ld,
-    /* 80 */
-    dmg_processor_instruction_add, dmg_processor_instruction_add, dmg_processor_instruction_add, dmg_processor_instruction_add,
-    dmg_processor_instruction_add, dmg_processor_instruction_add, dmg_processor_instruction_add, dmg_processor_instruction_add,
-    /* 88 */
-    dmg_processor_instruction_adc, dmg_processor_instruction_adc, dmg_processor_instruction_adc, dmg_processor_instruction_adc,
-    dmg_processor_instruction_adc, dmg_processor_instruction_adc, dmg_processor_instruction_adc, dmg_processor_instruction_adc,
-    /* 90 */
-    dmg_processor_instruction_sub, dmg_processor_instruction_sub, dmg_processor_instruction_sub, dmg_processor_instruction_sub,
-    dmg_processor_instruction_sub, dmg_processor_instruction_sub, dmg_processor_instruction_sub, dmg_processor_instruction_sub,
-    /* 98 */
-    dmg_processor_instruction_sbc, dmg_processor_instruction_sbc, dmg_processor_instruction_sbc, dmg_processor_instruction_sbc,
-    dmg_processor_instruction_sbc, dmg_processor_instruction_sbc, dmg_processor_instruction_sbc, dmg_processor_instruction_sbc,
-    /* A0 */
-    dmg_processor_instruction_and, dmg_processor_instruction_and, dmg_processor_instruction_and, dmg_processor_instruction_and,
-    dmg_processor_instruction_and, dmg_processor_instruction_and, dmg_processor_instruction_and, dmg_processor_instruction_and,
-    /* A8 */
-    dmg_processor_instruction_xor, dmg_processor_instruction_xor, dmg_processor_instruction_xor, dmg_processor_instruction_xor,
-    dmg_processor_instruction_xor, dmg_processor_instruction_xor, dmg_processor_instruction_xor, dmg_processor_instruction_xor,
-    /* B0 */
-    dmg_processor_instruction_or, dmg_processor_instruction_or, dmg_processor_instruction_or, dmg_processor_instruction_or,
-    dmg_processor_instruction_or, dmg_processor_instruction_or, dmg_processor_instruction_or, dmg_processor_instruction_or,
-    /* B8 */
-    dmg_processor_instruction_cp, dmg_processor_instruction_cp, dmg_processor_instruction_cp, dmg_processor_instruction_cp,
-    dmg_processor_instruction_cp, dmg_processor_instruction_cp, dmg_processor_instruction_cp, dmg_processor_instruction_cp,
-    /* C0 */
-    dmg_processor_instruction_ret, dmg_processor_instruction_pop, dmg_processor_instruction_jp, dmg_processor_instruction_jp,
-    dmg_processor_instruction_call, dmg_processor_instruction_push, dmg_processor_instruction_add, dmg_processor_instruction_rst,
-    /* C8 */
-    dmg_processor_instruction_ret, dmg_processor_instruction_ret, dmg_processor_instruction_jp, dmg_processor_instruction_xxx,
-    dmg_processor_instruction_call, dmg_processor_instruction_call, dmg_processor_instruction_adc, dmg_processor_instruction_rst,
-    /* D0 */
-    dmg_processor_instruction_ret, dmg_processor_instruction_pop, dmg_processor_instruction_jp, dmg_processor_instruction_xxx,
-    dmg_processor_instruction_call, dmg_processor_instruction_push, dmg_processor_instruction_sub, dmg_processor_instruction_rst,
-    /* D8 */
-    dmg_processor_instruction_ret, dmg_processor_instruction_reti, dmg_processor_instruction_jp, dmg_processor_instruction_xxx,
-    dmg_processor_instruction_call, dmg_processor_instruction_xxx, dmg_processor_instruction_sbc, dmg_processor_instruction_rst,
-    /* E0 */
-    dmg_processor_instruction_ld, dmg_processor_instruction_pop, dmg_processor_instruction_ld, dmg_processor_instruction_xxx,
-    dmg_processor_instruction_xxx, dmg_processor_instruction_push, dmg_processor_instruction_and, dmg_processor_instruction_rst,
-    /* E8 */
-    dmg_processor_instruction_add_sp, dmg_processor_instruction_jp_hl, dmg_processor_instruction_ld, dmg_processor_instruction_xxx,
-    dmg_processor_instruction_xxx, dmg_processor_instruction_xxx, dmg_processor_instruction_xor, dmg_processor_instruction_rst,
-    /* F0 */
-    dmg_processor_instruction_ld, dmg_processor_instruction_pop, dmg_processor_instruction_ld, dmg_processor_instruction_di,
-    dmg_processor_instruction_xxx, dmg_processor_instruction_push, dmg_processor_instruction_or, dmg_processor_instruction_rst,
-    /* F8 */
-    dmg_processor_instruction_ld_hl, dmg_processor_instruction_ld, dmg_processor_instruction_ld, dmg_processor_instruction_ei,
-    dmg_processor_instruction_xxx, dmg_processor_instruction_xxx, dmg_processor_instruction_cp, dmg_processor_instruction_rst,
-    /* CB 00 */
-    dmg_processor_instruction_rlc, dmg_processor_instruction_rlc, dmg_processor_instruction_rlc, dmg_processor_instruction_rlc,
-    dmg_processor_instruction_rlc, dmg_processor_instruction_rlc, dmg_processor_instruction_rlc, dmg_processor_instruction_rlc,
-    /* CB 08 */
-    dmg_processor_instruction_rrc, dmg_processor_instruction_rrc, dmg_processor_instruction_rrc, dmg_processor_instruction_rrc,
-    dmg_processor_instruction_rrc, dmg_processor_instruction_rrc, dmg_processor_instruction_rrc, dmg_processor_instruction_rrc,
-    /* CB 10 */
-    dmg_processor_instruction_rl, dmg_processor_instruction_rl, dmg_processor_instruction_rl, dmg_processor_instruction_rl,
-    dmg_processor_instruction_rl, dmg_processor_instruction_rl, dmg_processor_instruction_rl, dmg_processor_instruction_rl,
-    /* CB 18 */
-    dmg_processor_instruction_rr, dmg_processor_instruction_rr, dmg_processor_instruction_rr, dmg_processor_instruction_rr,
-    dmg_processor_instruction_rr, dmg_processor_instruction_rr, dmg_processor_instruction_rr, dmg_processor_instruction_rr,
-    /* CB 20 */
-    dmg_processor_instruction_sla, dmg_processor_instruction_sla, dmg_processor_instruction_sla, dmg_processor_instruction_sla,
-    dmg_processor_instruction_sla, dmg_processor_instruction_sla, dmg_processor_instruction_sla, dmg_processor_instruction_sla,
-    /* CB 28 */
-    dmg_processor_instruction_sra, dmg_processor_instruction_sra, dmg_processor_instruction_sra, dmg_processor_instruction_sra,
-    dmg_processor_instruction_sra, dmg_processor_instruction_sra, dmg_processor_instruction_sra, dmg_processor_instruction_sra,
-    /* CB 30 */
-    dmg_processor_instruction_swap, dmg_processor_instruction_swap, dmg_processor_instruction_swap, dmg_processor_instruction_swap,
-    dmg_processor_instruction_swap, dmg_processor_instruction_swap, dmg_processor_instruction_swap, dmg_processor_instruction_swap,
-    /* CB 38 */
-    dmg_processor_instruction_srl, dmg_processor_instruction_srl, dmg_processor_instruction_srl, dmg_processor_instruction_srl,
-    dmg_processor_instruction_srl, dmg_processor_instruction_srl, dmg_processor_instruction_srl, dmg_processor_instruction_srl,
-    /* CB 40 */
-    dmg_processor_instruction_bit, dmg_processor_instruction_bit, dmg_processor_instruction_bit, dmg_processor_instruction_bit,
-    dmg_processor_instruction_bit, dmg_processor_instruction_bit, dmg_processor_instruction_bit, dmg_processor_instruction_bit,
-    /* CB 48 */
-    dmg_processor_instruction_bit, dmg_processor_instruction_bit, dmg_processor_instruction_bit, dmg_processor_instruction_bit,
-    dmg_processor_instruction_bit, dmg_processor_instruction_bit, dmg_processor_instruction_bit, dmg_processor_instruction_bit,
-    /* CB 50 */
-    dmg_processor_instruction_bit, dmg_processor_instruction_bit, dmg_processor_instruction_bit, dmg_processor_instruction_bit,
-    dmg_processor_instruction_bit, dmg_processor_instruction_bit, dmg_processor_instruction_bit, dmg_processor_instruction_bit,
-    /* CB 58 */
-    dmg_processor_instruction_bit, dmg_processor_instruction_bit, dmg_processor_instruction_bit, dmg_processor_instruction_bit,
-    dmg_processor_instruction_bit, dmg_processor_instruction_bit, dmg_processor_instruction_bit, dmg_processor_instruction_bit,
-    /* CB 60 */
-    dmg_processor_instruction_bit, dmg_processor_instruction_bit, dmg_processor_instruction_bit, dmg_processor_instruction_bit,
-    dmg_processor_instruction_bit, dmg_processor_instruction_bit, dmg_processor_instruction_bit, dmg_processor_instruction_bit,
-    /* CB 68 */
-    dmg_processor_instruction_bit, dmg_processor_instruction_bit, dmg_processor_instruction_bit, dmg_processor_instruction_bit,
-    dmg_processor_instruction_bit, dmg_processor_instruction_bit, dmg_processor_instruction_bit, dmg_processor_instruction_bit,
-    /* CB 70 */
-    dmg_processor_instruction_bit, dmg_processor_instruction_bit, dmg_processor_instruction_bit, dmg_processor_instruction_bit,
-    dmg_processor_instruction_bit, dmg_processor_instruction_bit, dmg_processor_instruction_bit, dmg_processor_instruction_bit,
-    /* CB 78 */
-    dmg_processor_instruction_bit, dmg_processor_instruction_bit, dmg_processor_instruction_bit, dmg_processor_instruction_bit,
-    dmg_processor_instruction_bit, dmg_processor_instruction_bit, dmg_processor_instruction_bit, dmg_processor_instruction_bit,
-    /* CB 80 */
-    dmg_processor_instruction_res, dmg_processor_instruction_res, dmg_processor_instruction_res, dmg_processor_instruction_res,
-    dmg_processor_instruction_res, dmg_processor_instruction_res, dmg_processor_instruction_res, dmg_processor_instruction_res,
-    /* CB 88 */
-    dmg_processor_instruction_res, dmg_processor_instruction_res, dmg_processor_instruction_res, dmg_processor_instruction_res,
-    dmg_processor_instruction_res, dmg_processor_instruction_res, dmg_processor_instruction_res, dmg_processor_instruction_res,
-    /* CB 90 */
-    dmg_processor_instruction_res, dmg_processor_instruction_res, dmg_processor_instruction_res, dmg_processor_instruction_res,
-    dmg_processor_instruction_res, dmg_processor_instruction_res, dmg_processor_instruction_res, dmg_processor_instruction_res,
-    /* CB 98 */
-    dmg_processor_instruction_res, dmg_processor_instruction_res, dmg_processor_instruction_res, dmg_processor_instruction_res,
-    dmg_processor_instruction_res, dmg_processor_instruction_res, dmg_processor_instruction_res, dmg_processor_instruction_res,
-    /* CB A0 */
-    dmg_processor_instruction_res, dmg_processor_instruction_res, dmg_processor_instruction_res, dmg_processor_instruction_res,
-    dmg_processor_instruction_res, dmg_processor_instruction_res, dmg_processor_instruction_res, dmg_processor_instruction_res,
-    /* CB A8 */
-    dmg_processor_instruction_res, dmg_processor_instruction_res, dmg_processor_instruction_res, dmg_processor_instruction_res,
-    dmg_processor_instruction_res, dmg_processor_instruction_res, dmg_processor_instruction_res, dmg_processor_instruction_res,
-    /* CB B0 */
-    dmg_processor_instruction_res, dmg_processor_instruction_res, dmg_processor_instruction_res, dmg_processor_instruction_res,
-    dmg_processor_instruction_res, dmg_processor_instruction_res, dmg_processor_instruction_res, dmg_processor_instruction_res,
-    /* CB B8 */
-    dmg_processor_instruction_res, dmg_processor_instruction_res, dmg_processor_instruction_res, dmg_processor_instruction_res,
-    dmg_processor_instruction_res, dmg_processor_instruction_res, dmg_processor_instruction_res, dmg_processor_instruction_res,
-    /* CB C0 */
-    dmg_processor_instruction_set, dmg_processor_instruction_set, dmg_processor_instruction_set, dmg_processor_instruction_set,
-    dmg_processor_instruction_set, dmg_processor_instruction_set, dmg_processor_instruction_set, dmg_processor_instruction_set,
-    /* CB C8 */
-    dmg_processor_instruction_set, dmg_processor_instruction_set, dmg_processor_instruction_set, dmg_processor_instruction_set,
-    dmg_processor_instruction_set, dmg_processor_instruction_set, dmg_processor_instruction_set, dmg_processor_instruction_set,
-    /* CB D0 */
-    dmg_processor_instruction_set, dmg_processor_instruction_set, dmg_processor_instruction_set, dmg_processor_instruction_set,
-    dmg_processor_instruction_set, dmg_processor_instruction_set, dmg_processor_instruction_set, dmg_processor_instruction_set,
-    /* CB D8 */
-    dmg_processor_instruction_set, dmg_processor_instruction_set, dmg_processor_instruction_set, dmg_processor_instruction_set,
-    dmg_processor_instruction_set, dmg_processor_instruction_set, dmg_processor_instruction_set, dmg_processor_instruction_set,
-    /* CB E0 */
-    dmg_processor_instruction_set, dmg_processor_instruction_set, dmg_processor_instruction_set, dmg_processor_instruction_set,
-    dmg_processor_instruction_set, dmg_processor_instruction_set, dmg_processor_instruction_set, dmg_processor_instruction_set,
-    /* CB E8 */
-    dmg_processor_instruction_set, dmg_processor_instruction_set, dmg_processor_instruction_set, dmg_processor_instruction_set,
-    dmg_processor_instruction_set, dmg_processor_instruction_set, dmg_processor_instruction_set, dmg_processor_instruction_set,
-    /* CB F0 */
-    dmg_processor_instruction_set, dmg_processor_instruction_set, dmg_processor_instruction_set, dmg_processor_instruction_set,
-    dmg_processor_instruction_set, dmg_processor_instruction_set, dmg_processor_instruction_set, dmg_processor_instruction_set,
-    /* CB F8 */
-    dmg_processor_instruction_set, dmg_processor_instruction_set, dmg_processor_instruction_set, dmg_processor_instruction_set,
-    dmg_processor_instruction_set, dmg_processor_instruction_set, dmg_processor_instruction_set, dmg_processor_instruction_set,
+        DMG_PROCESSOR_INSTRUCTION(DMG_THREAD_ENTRY)
+        DMG_PROCESSOR_INSTRUCTION_EXTENDED(DMG_THREAD_EXTENDED_ENTRY)
     };
-
-static void dmg_processor_execute(dmg_t const dmg)
-{
-    bool extended;
-    dmg->processor.instruction.address = dmg->processor.pc.word;
-    dmg->processor.instruction.opcode = dmg_system_read(dmg, dmg->processor.pc.word++);
-    if ((extended = (dmg->processor.instruction.opcode == 0xCB)))
+    if (dmg->processor.jit.block)
     {
-        dmg->processor.instruction.opcode = dmg_system_read(dmg, dmg->processor.pc.word++);
+        return dmg_processor_step(dmg);
     }
-    INSTRUCTION[extended ? dmg->processor.instruction.opcode + 256 : dmg->processor.instruction.opcode](dmg);
+    DMG_THREAD_DISPATCH()
+step:
+    dmg_processor_step(dmg);
+    DMG_THREAD_NEXT()
+    DMG_PROCESSOR_INSTRUCTION(DMG_THREAD)
+    DMG_PROCESSOR_INSTRUCTION_EXTENDED(DMG_THREAD_EXTENDED)
 }
+#endif /* DMG_THREADED */
 
-static void dmg_processor_service(dmg_t const dmg)
+uint8_t dmg_processor_step(dmg_t const dmg)
 {
-    dmg_interrupt_e interrupt;
-    for (interrupt = 0; interrupt < DMG_INTERRUPT_MAX; ++interrupt)
+    if (dmg->processor.interrupt.enable_delay && !--dmg->processor.interrupt.enable_delay)
     {
-        uint8_t mask = 1 << interrupt;
-        if (dmg->processor.interrupt.enable & dmg->processor.interrupt.flag & mask)
-        {
-            dmg_system_write(dmg, --dmg->processor.sp.word, dmg->processor.pc.high);
-            dmg_system_write(dmg, --dmg->processor.sp.word, dmg->processor.pc.low);
-            dmg->processor.pc.word = (0x0008 * interrupt) + 0x0040;
-            dmg->processor.interrupt.enabled = false;
-            dmg->processor.interrupt.flag &= ~mask;
-            dmg->processor.delay = 20;
-            break;
-        }
+        dmg->processor.interrupt.enabled = true;
     }
-}
-
-void dmg_processor_clock(dmg_t const dmg)
-{
-    if (!dmg->processor.delay)
+    if (dmg->processor.interrupt.enable & dmg->processor.interrupt.flag & 0x1F)
     {
-        if (dmg->processor.interrupt.enable_delay && !--dmg->processor.interrupt.enable_delay)
+        dmg->processor.halted = false;
+        if (dmg->processor.interrupt.enabled)
         {
-            dmg->processor.interrupt.enabled = true;
-        }
-        if (dmg->processor.interrupt.enable & dmg->processor.interrupt.flag & 0x1F)
-        {
-            dmg->processor.halted = false;
-            if (dmg->processor.interrupt.enabled)
-            {
-                dmg_processor_service(dmg);
-            }
-            else if (!dmg->processor.halted && !dmg->processor.stopped)
-            {
-                dmg_processor_execute(dmg);
-            }
-            else
-            {
-                dmg->processor.delay = 4;
-            }
+            dmg_processor_service(dmg);
         }
         else if (!dmg->processor.halted && !dmg->processor.stopped)
         {
@@ -2000,29 +1680,28 @@ void dmg_processor_clock(dmg_t const dmg)
             dmg->processor.delay = 4;
         }
     }
-    --dmg->processor.delay;
-}
-
-void dmg_processor_interrupt(dmg_t const dmg, dmg_interrupt_e interrupt)
-{
-    dmg_processor_write(dmg, 0xFF0F, dmg->processor.interrupt.flag | (1 << interrupt));
+    else if (!dmg->processor.halted && !dmg->processor.stopped)
+    {
+        dmg_processor_execute(dmg);
+    }
+    else
+    {
+        dmg->processor.delay = dmg_processor_wait(dmg);
+    }
+    return dmg->processor.delay;
 }
 
-uint8_t dmg_processor_read(dmg_t const dmg, uint16_t address)
+void dmg_processor_uninitialize(dmg_t const dmg)
 {
-    uint8_t result = 0xFF;
-    switch (address)
+#ifdef DMG_JIT
+    if (dmg->processor.jit.arena)
     {
-        case 0xFF0F: /* IF */
-            result = dmg->processor.interrupt.flag;
-            break;
-        case 0xFFFF: /* IE */
-            result = dmg->processor.interrupt.enable;
-            break;
-        default:
-            break;
+        munmap(dmg->processor.jit.arena, DMG_JIT_ARENA);
+        dmg->processor.jit.arena = NULL;
     }
-    return result;
+#endif /* DMG_JIT */
+    free(dmg->processor.jit.block);
+    dmg->processor.jit.block = NULL;
 }
 
 void dmg_processor_write(dmg_t const dmg, uint16_t address, uint8_t value)
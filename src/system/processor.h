@@ -8,6 +8,25 @@
 
 #include <common.h>
 
+#if defined(__x86_64__) && defined(__unix__)
+#define DMG_JIT
+#endif /* __x86_64__ && __unix__ */
+
+typedef enum
+{
+    DMG_FLAG_NONE = 0,
+    DMG_FLAG_ADD,
+    DMG_FLAG_AND,
+    DMG_FLAG_BIT,
+    DMG_FLAG_DEC,
+    DMG_FLAG_INC,
+    DMG_FLAG_LOGIC,
+    DMG_FLAG_ROTATE,
+    DMG_FLAG_SHIFT,
+    DMG_FLAG_SUB,
+    DMG_FLAG_MAX,
+} dmg_flag_e;
+
 typedef enum
 {
     DMG_INTERRUPT_VBLANK = 0,
@@ -39,6 +58,23 @@ typedef union
     uint16_t word;
 } dmg_register_t;
 
+typedef struct
+{
+    uint16_t bank;
+    uint16_t index;
+    uint8_t length;
+    dmg_register_t operand;
+} dmg_decode_t;
+
+typedef uint8_t (*dmg_block_f)(dmg_t const dmg);
+
+typedef struct
+{
+    uint16_t bank;
+    uint8_t count;
+    dmg_block_f entry;
+} dmg_block_t;
+
 typedef struct
 {
     uint8_t delay;
@@ -54,19 +90,57 @@ typedef struct
     {
         uint16_t address;
         uint8_t opcode;
+        dmg_register_t operand;
     } instruction;
     struct
+    {
+        dmg_flag_e operation;
+        bool carry;
+        uint8_t operand;
+        uint16_t result;
+    } flag;
+    struct
+    {
+        uint16_t address;
+        uint64_t cycle;
+        uint64_t timestamp;
+    } idle;
+    struct
     {
         int8_t enable_delay;
         bool enabled;
         uint8_t enable;
         uint8_t flag;
     } interrupt;
+    struct
+    {
+        uint16_t bank[0x80];
+        dmg_decode_t entry[0x8000];
+    } cache;
+    struct
+    {
+        uint16_t daa[0x800];
+        uint8_t flag[DMG_FLAG_MAX << 5];
+    } table;
+    struct
+    {
+        uint8_t *arena;
+        uint32_t offset;
+        dmg_block_t *block;
+    } jit;
 } dmg_processor_t;
 
-void dmg_processor_clock(dmg_t const dmg);
+uint8_t dmg_processor_disassemble(dmg_t const dmg, uint16_t address, char *const buffer, uint32_t length);
+dmg_error_e dmg_processor_initialize(dmg_t const dmg);
 void dmg_processor_interrupt(dmg_t const dmg, dmg_interrupt_e interrupt);
+void dmg_processor_invalidate(dmg_t const dmg);
+dmg_error_e dmg_processor_jit(dmg_t const dmg);
 uint8_t dmg_processor_read(dmg_t const dmg, uint16_t address);
+#ifdef DMG_THREADED
+uint8_t dmg_processor_run(dmg_t const dmg);
+#endif /* DMG_THREADED */
+uint8_t dmg_processor_step(dmg_t const dmg);
+void dmg_processor_uninitialize(dmg_t const dmg);
 void dmg_processor_write(dmg_t const dmg, uint16_t address, uint8_t value);
 
 #endif /* DMG_PROCESSOR_H_ */
@@ -5,25 +5,31 @@
 
 #include <system.h>
 
-void dmg_serial_clock(dmg_t const dmg)
+static void dmg_serial_clock(dmg_t const dmg, uint64_t cycle)
 {
+    dmg_system_unschedule(dmg, DMG_EVENT_SERIAL);
     if (dmg->serial.control.enabled && dmg->serial.control.mode)
     {
-        if (!dmg->serial.delay)
+        dmg->serial.data = (dmg->serial.data << 1) | (dmg->serial.output((dmg->serial.data & 0x80) ? 1 : 0) & 1);
+        if (++dmg->serial.index > 7)
         {
-            dmg->serial.data = (dmg->serial.data << 1) | (dmg->serial.output((dmg->serial.data & 0x80) ? 1 : 0) & 1);
-            if (++dmg->serial.index > 7)
-            {
-                dmg_processor_interrupt(dmg, DMG_INTERRUPT_SERIAL);
-                dmg->serial.control.enabled = false;
-                dmg->serial.index = 0;
-            }
-            else
-            {
-                dmg->serial.delay = 512; /* 8KHz */
-            }
+            dmg_processor_interrupt(dmg, DMG_INTERRUPT_SERIAL);
+            dmg->serial.control.enabled = false;
+            dmg->serial.index = 0;
+        }
+        else
+        {
+            dmg_system_schedule(dmg, DMG_EVENT_SERIAL, cycle + 512); /* 8KHz */
         }
-        --dmg->serial.delay;
+    }
+}
+
+void dmg_serial_advance(dmg_t const dmg, uint32_t cycles)
+{
+    uint64_t cycle, end = dmg_system_cycle(dmg) + cycles;
+    while ((cycle = dmg_system_timestamp(dmg, DMG_EVENT_SERIAL)) <= end)
+    {
+        dmg_serial_clock(dmg, cycle);
     }
 }
 
@@ -84,9 +90,16 @@ void dmg_serial_write(dmg_t const dmg, uint16_t address, uint8_t value)
             dmg->serial.control.raw = 0x7E | value;
             if (dmg->serial.control.enabled)
             {
-                dmg->serial.delay = 0;
                 dmg->serial.index = 0;
             }
+            if (dmg->serial.control.enabled && dmg->serial.control.mode)
+            {
+                dmg_system_schedule(dmg, DMG_EVENT_SERIAL, dmg_system_cycle(dmg) + 1);
+            }
+            else
+            {
+                dmg_system_unschedule(dmg, DMG_EVENT_SERIAL);
+            }
             break;
         default:
             break;
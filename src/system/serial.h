@@ -11,7 +11,6 @@
 typedef struct
 {
     uint8_t data;
-    uint16_t delay;
     uint8_t index;
     dmg_output_f output;
     union
@@ -26,7 +25,7 @@ typedef struct
     } control;
 } dmg_serial_t;
 
-void dmg_serial_clock(dmg_t const dmg);
+void dmg_serial_advance(dmg_t const dmg, uint32_t cycles);
 dmg_error_e dmg_serial_initialize(dmg_t const dmg, const dmg_output_f output);
 uint8_t dmg_serial_input(dmg_t const dmg, uint8_t value);
 uint8_t dmg_serial_read(dmg_t const dmg, uint16_t address);
@@ -11,8 +11,6 @@ static const uint16_t OFFSET[] =
     512, 8, 32, 128,
     /* AUDIO (256Hz) */
     8192,
-    /* MAPPER (1KHz) */
-    2048,
 };
 
 static void dmg_timer_increment_audio(dmg_t const dmg)
@@ -25,16 +23,6 @@ static void dmg_timer_increment_audio(dmg_t const dmg)
     dmg->timer.overflow[1] = overflow;
 }
 
-static void dmg_timer_increment_mapper(dmg_t const dmg)
-{
-    bool overflow = dmg->timer.divider & OFFSET[5];
-    if (dmg->timer.overflow[2] && !overflow)
-    {
-        dmg_mapper_interrupt(dmg);
-    }
-    dmg->timer.overflow[2] = overflow;
-}
-
 static void dmg_timer_increment_counter(dmg_t const dmg)
 {
     bool overflow = dmg->timer.divider & OFFSET[dmg->timer.control.mode];
@@ -46,20 +34,105 @@ static void dmg_timer_increment_counter(dmg_t const dmg)
     dmg->timer.overflow[0] = overflow;
 }
 
-void dmg_timer_clock(dmg_t const dmg)
+static uint32_t dmg_timer_edge(dmg_t const dmg, bool overflow, uint16_t offset)
+{
+    uint32_t result = (2 * offset) - (dmg->timer.divider & ((2 * offset) - 1));
+    if (overflow && !((dmg->timer.divider + 1) & offset))
+    { /* STALE EDGE AFTER DIV/TAC WRITE */
+        result = 1;
+    }
+    else if (result == 1)
+    {
+        result += 2 * offset;
+    }
+    return result;
+}
+
+static uint32_t dmg_timer_edge_counter(dmg_t const dmg)
+{
+    uint16_t offset = OFFSET[dmg->timer.control.mode];
+    uint32_t result = dmg_timer_edge(dmg, dmg->timer.overflow[0], offset), remaining = 0xFF - dmg->timer.counter;
+    if (remaining)
+    { /* ONLY THE EDGE THAT OVERFLOWS TIMA NEEDS AN EVENT */
+        if ((result == 1) && !(dmg->timer.divider & offset))
+        { /* STALE EDGE IS OUT OF PHASE WITH THE EDGES THAT FOLLOW */
+            result = dmg_timer_edge(dmg, false, offset);
+            --remaining;
+        }
+        result += remaining * 2 * offset;
+    }
+    return result;
+}
+
+static uint8_t dmg_timer_edges(dmg_t const dmg, uint64_t cycles)
+{
+    uint16_t offset = OFFSET[dmg->timer.control.mode];
+    uint64_t result = ((dmg->timer.divider + cycles) / (2 * offset)) - (dmg->timer.divider / (2 * offset));
+    if ((dmg->timer.divider & offset) && !((dmg->timer.divider + 1) & offset))
+    { /* FIRST EDGE FOLLOWS THE LATCHED BIT, NOT THE DIVIDER */
+        --result;
+    }
+    if (dmg->timer.overflow[0] && !((dmg->timer.divider + 1) & offset))
+    {
+        ++result;
+    }
+    return result;
+}
+
+static void dmg_timer_schedule(dmg_t const dmg)
+{
+    uint32_t delay = dmg_timer_edge(dmg, dmg->timer.overflow[1], OFFSET[4]), edge;
+    if (dmg->timer.control.enabled && ((edge = dmg_timer_edge_counter(dmg)) < delay))
+    {
+        delay = edge;
+    }
+    dmg_system_schedule(dmg, DMG_EVENT_TIMER, dmg->timer.cycle - 1 + delay);
+}
+
+static void dmg_timer_update(dmg_t const dmg, uint64_t cycle)
 {
+    if (cycle > dmg->timer.cycle)
+    { /* TIMA EDGES BEFORE THE OVERFLOW ARE COUNTED, NO OTHER EDGES FALL BETWEEN EVENTS */
+        if (dmg->timer.control.enabled)
+        {
+            dmg->timer.counter += dmg_timer_edges(dmg, cycle - dmg->timer.cycle);
+        }
+        dmg->timer.divider += cycle - dmg->timer.cycle;
+        dmg->timer.overflow[1] = dmg->timer.divider & OFFSET[4];
+        if (dmg->timer.control.enabled)
+        {
+            dmg->timer.overflow[0] = dmg->timer.divider & OFFSET[dmg->timer.control.mode];
+        }
+        dmg->timer.cycle = cycle;
+    }
+}
+
+static void dmg_timer_clock(dmg_t const dmg, uint64_t cycle)
+{
+    dmg_timer_update(dmg, cycle);
     ++dmg->timer.divider;
     dmg_timer_increment_audio(dmg);
-    dmg_timer_increment_mapper(dmg);
     if (dmg->timer.control.enabled)
     {
         dmg_timer_increment_counter(dmg);
     }
+    ++dmg->timer.cycle;
+    dmg_timer_schedule(dmg);
+}
+
+void dmg_timer_advance(dmg_t const dmg, uint32_t cycles)
+{
+    uint64_t cycle, end = dmg_system_cycle(dmg) + cycles;
+    while ((cycle = dmg_system_timestamp(dmg, DMG_EVENT_TIMER)) <= end)
+    {
+        dmg_timer_clock(dmg, cycle);
+    }
 }
 
 uint8_t dmg_timer_read(dmg_t const dmg, uint16_t address)
 {
     uint8_t result = 0xFF;
+    dmg_timer_update(dmg, dmg_system_cycle(dmg) + 1);
     switch (address)
     {
         case 0xFF04: /* DIV */
@@ -82,6 +155,7 @@ uint8_t dmg_timer_read(dmg_t const dmg, uint16_t address)
 
 void dmg_timer_write(dmg_t const dmg, uint16_t address, uint8_t value)
 {
+    dmg_timer_update(dmg, dmg_system_cycle(dmg) + 1);
     switch (address)
     {
         case 0xFF04: /* DIV */
@@ -104,4 +178,5 @@ void dmg_timer_write(dmg_t const dmg, uint16_t address, uint8_t value)
         default:
             break;
     }
+    dmg_timer_schedule(dmg);
 }
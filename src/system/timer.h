@@ -11,9 +11,10 @@
 typedef struct
 {
     uint8_t counter;
+    uint64_t cycle;
     uint16_t divider;
     uint8_t modulo;
-    bool overflow[3];
+    bool overflow[2];
     union
     {
         struct
@@ -25,7 +26,7 @@ typedef struct
     } control;
 } dmg_timer_t;
 
-void dmg_timer_clock(dmg_t const dmg);
+void dmg_timer_advance(dmg_t const dmg, uint32_t cycles);
 uint8_t dmg_timer_read(dmg_t const dmg, uint16_t address);
 void dmg_timer_write(dmg_t const dmg, uint16_t address, uint8_t value);
 
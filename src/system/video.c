@@ -5,24 +5,170 @@
 
 #include <system.h>
 
-static uint8_t dmg_video_background_color(dmg_t const dmg, bool map, uint8_t x, uint8_t y)
+static void dmg_video_decode(dmg_t const dmg, uint16_t address)
 {
-    uint16_t address = (map ? 0x1C00 : 0x1800) + (32 * ((y / 8) & 31)) + ((x / 8) & 31);
-    if (dmg->video.control.background_data)
+    uint16_t tile = address / 16;
+    uint8_t y = (address / 2) & 7;
+    const uint8_t *data = &dmg->video.ram[address & 0xFFFE];
+#if defined(DMG_NEON)
+    static const uint8_t MASK[] = { 0x80, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x01, 0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80 };
+    uint8x16_t mask = vld1q_u8(MASK);
+    uint8x16_t color = vorrq_u8(vandq_u8(vtstq_u8(vdupq_n_u8(data[0]), mask), vdupq_n_u8(1)), vandq_u8(vtstq_u8(vdupq_n_u8(data[1]), mask), vdupq_n_u8(2)));
+    vst1_u8(dmg->video.tile.row[0][tile][y], vget_low_u8(color));
+    vst1_u8(dmg->video.tile.row[1][tile][y], vget_high_u8(color));
+#elif defined(DMG_SSE)
+    __m128i mask = _mm_setr_epi8(0x80, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x01, 0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80);
+    __m128i low = _mm_cmpeq_epi8(_mm_and_si128(_mm_set1_epi8(data[0]), mask), mask), high = _mm_cmpeq_epi8(_mm_and_si128(_mm_set1_epi8(data[1]), mask), mask);
+    __m128i color = _mm_or_si128(_mm_and_si128(low, _mm_set1_epi8(1)), _mm_and_si128(high, _mm_set1_epi8(2)));
+    _mm_storel_epi64((__m128i *)dmg->video.tile.row[0][tile][y], color);
+    _mm_storel_epi64((__m128i *)dmg->video.tile.row[1][tile][y], _mm_srli_si128(color, 8));
+#else
+    for (uint8_t x = 0; x < 8; ++x)
+    { /* ROW 0 IS UNFLIPPED, ROW 1 IS X-FLIPPED */
+        uint8_t color = (((data[1] >> (7 - x)) & 1) << 1) | ((data[0] >> (7 - x)) & 1);
+        dmg->video.tile.row[0][tile][y][x] = color;
+        dmg->video.tile.row[1][tile][y][7 - x] = color;
+    }
+#endif /* DMG_NEON */
+}
+
+static void dmg_video_merge_scalar(const uint8_t *shade, const uint8_t *row, uint8_t *color, bool priority)
+{
+    for (uint8_t x = 0; x < 8; ++x)
+    {
+        if (row[x] && (!priority || (color[x] == DMG_COLOR_WHITE)))
+        {
+            color[x] = shade[row[x]];
+        }
+    }
+}
+
+static void dmg_video_shade_scalar(const uint8_t *shade, uint8_t *color)
+{
+    for (uint8_t x = 0; x < 160; ++x)
+    {
+        color[x] = shade[color[x]];
+    }
+}
+
+#if defined(DMG_NEON)
+
+static void dmg_video_merge_neon(const uint8_t *shade, const uint8_t *row, uint8_t *color, bool priority)
+{
+    uint8x8_t index = vld1_u8(row), value = vld1_u8(color), table = vcreate_u8(shade[0] | (shade[1] << 8) | (shade[2] << 16) | ((uint64_t)shade[3] << 24));
+    uint8x8_t mask = vmvn_u8(vceq_u8(index, vdup_n_u8(0)));
+    if (priority)
+    {
+        mask = vand_u8(mask, vceq_u8(value, vdup_n_u8(0)));
+    }
+    vst1_u8(color, vbsl_u8(mask, vtbl1_u8(table, index), value));
+}
+
+static void dmg_video_shade_neon(const uint8_t *shade, uint8_t *color)
+{
+    uint8x16_t table = vcombine_u8(vcreate_u8(shade[0] | (shade[1] << 8) | (shade[2] << 16) | ((uint64_t)shade[3] << 24)), vdup_n_u8(0));
+    for (uint8_t x = 0; x < 160; x += 16)
+    {
+        vst1q_u8(color + x, vqtbl1q_u8(table, vld1q_u8(color + x)));
+    }
+}
+
+#elif defined(DMG_SSE)
+
+__attribute__((target("ssse3"))) static void dmg_video_merge_ssse3(const uint8_t *shade, const uint8_t *row, uint8_t *color, bool priority)
+{
+    __m128i index = _mm_loadl_epi64((const __m128i *)row), value = _mm_loadl_epi64((const __m128i *)color), table = _mm_setr_epi8(shade[0], shade[1], shade[2], shade[3], 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0);
+    __m128i mask = _mm_andnot_si128(_mm_cmpeq_epi8(index, _mm_setzero_si128()), _mm_set1_epi8(-1));
+    if (priority)
     {
-        address = (16 * dmg->video.ram[address]) + (2 * (y & 7));
+        mask = _mm_and_si128(mask, _mm_cmpeq_epi8(value, _mm_setzero_si128()));
+    }
+    _mm_storel_epi64((__m128i *)color, _mm_or_si128(_mm_and_si128(mask, _mm_shuffle_epi8(table, index)), _mm_andnot_si128(mask, value)));
+}
+
+__attribute__((target("ssse3"))) static void dmg_video_shade_ssse3(const uint8_t *shade, uint8_t *color)
+{
+    __m128i table = _mm_setr_epi8(shade[0], shade[1], shade[2], shade[3], 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0);
+    for (uint8_t x = 0; x < 160; x += 16)
+    {
+        _mm_storeu_si128((__m128i *)(color + x), _mm_shuffle_epi8(table, _mm_loadu_si128((const __m128i *)(color + x))));
+    }
+}
+
+#endif /* DMG_NEON */
+
+static void dmg_video_invalidate(dmg_t const dmg, uint8_t first, uint8_t last)
+{
+    if (dmg->video.dirty.first > dmg->video.dirty.last)
+    { /* NO LINES CHANGED SINCE THE LAST FRAME */
+        dmg->video.dirty.first = first;
+        dmg->video.dirty.last = last;
     }
     else
     {
-        address = (16 * (int8_t)dmg->video.ram[address]) + (2 * (y & 7)) + 0x1000;
+        if (first < dmg->video.dirty.first)
+        {
+            dmg->video.dirty.first = first;
+        }
+        if (last > dmg->video.dirty.last)
+        {
+            dmg->video.dirty.last = last;
+        }
+    }
+}
+
+static void dmg_video_index_objects(dmg_t const dmg)
+{
+    uint8_t size = dmg->video.control.object_size ? 16 : 8;
+    for (uint8_t y = 0; y < 144; ++y)
+    {
+        dmg->video.object.bucket.line[y].count = 0;
+    }
+    for (uint8_t index = 0; index < 40; ++index)
+    { /* FIRST 10 OBJECTS IN OAM ORDER, DRAWN BY DESCENDING X, THEN DESCENDING INDEX */
+        const dmg_object_t *object = &dmg->video.object.ram[index];
+        uint16_t key = (object->x << 6) | index;
+        for (int16_t y = (object->y < 16) ? 0 : (object->y - 16); (y < (object->y - 16 + size)) && (y < 144); ++y)
+        {
+            dmg_object_bucket_t *bucket = &dmg->video.object.bucket.line[y];
+            if (bucket->count < 10)
+            {
+                uint8_t position = 0;
+                for (uint8_t entry = 0; entry < bucket->count; ++entry)
+                {
+                    position += (((dmg->video.object.ram[bucket->index[entry]].x << 6) | bucket->index[entry]) > key);
+                }
+                memmove(&bucket->index[position + 1], &bucket->index[position], bucket->count - position);
+                bucket->index[position] = index;
+                ++bucket->count;
+            }
+        }
+    }
+    dmg->video.object.bucket.dirty = false;
+    dmg->video.object.bucket.size = dmg->video.control.object_size;
+}
+
+static void dmg_video_merge(dmg_t const dmg, const uint8_t *shade, const uint8_t *row, uint8_t *color, bool priority)
+{
+    switch (dmg->video.kernel)
+    {
+#if defined(DMG_NEON)
+        case DMG_KERNEL_NEON:
+            dmg_video_merge_neon(shade, row, color, priority);
+            break;
+#elif defined(DMG_SSE)
+        case DMG_KERNEL_SSSE3:
+            dmg_video_merge_ssse3(shade, row, color, priority);
+            break;
+#endif /* DMG_NEON */
+        default:
+            dmg_video_merge_scalar(shade, row, color, priority);
+            break;
     }
-    x = 1 << (7 - (x & 7));
-    return ((dmg->video.ram[address + 1] & x) ? 2 : 0) + ((dmg->video.ram[address] & x) ? 1 : 0);
 }
 
-static uint8_t dmg_video_object_color(dmg_t const dmg, const dmg_object_t *object, uint8_t x, uint8_t y)
+static const uint8_t *dmg_video_object_row(dmg_t const dmg, const dmg_object_t *object, uint8_t y)
 {
-    uint16_t address;
     uint8_t id = object->id;
     if (dmg->video.control.object_size)
     {
@@ -47,135 +193,104 @@ static uint8_t dmg_video_object_color(dmg_t const dmg, const dmg_object_t *objec
         }
     }
     y = (y - object->y) & 7;
-    if (object->attribute.x_flip)
-    {
-        x = 7 - x;
-    }
     if (object->attribute.y_flip)
     {
         y = 7 - y;
     }
-    address = (16 * id) + (2 * y);
-    x = 1 << (7 - x);
-    return ((dmg->video.ram[address + 1] & x) ? 2 : 0) + ((dmg->video.ram[address] & x) ? 1 : 0);
+    return dmg->video.tile.row[object->attribute.x_flip][id][y];
 }
 
-static int dmg_video_object_comparator(const void *first, const void *second)
+static void dmg_video_palette(dmg_palette_t *palette, uint8_t *shade, uint8_t value)
 {
-    int result;
-    const dmg_object_entry_t *entry[] = { first, second };
-    if (entry[0]->object->x < entry[1]->object->x)
-    {
-        result = 1;
-    }
-    else if (entry[0]->object->x == entry[1]->object->x)
-    {
-        result = (entry[0]->index < entry[1]->index) ? 1 : 0;
-    }
-    else
+    palette->raw = value;
+    for (uint8_t color = DMG_COLOR_WHITE; color < DMG_COLOR_MAX; ++color)
     {
-        result = -1;
+        shade[color] = (value >> (2 * color)) & 3;
     }
-    return result;
 }
 
-static dmg_color_e dmg_video_palette_color(const dmg_palette_t *palette, dmg_color_e color)
+static void dmg_video_shade(dmg_t const dmg, const uint8_t *shade, uint8_t *color)
 {
-    dmg_color_e result = 0;
-    switch (color)
+    switch (dmg->video.kernel)
     {
-        case DMG_COLOR_WHITE:
-            result = palette->white;
-            break;
-        case DMG_COLOR_LIGHT_GREY:
-            result = palette->light_grey;
-            break;
-        case DMG_COLOR_DARK_GREY:
-            result = palette->dark_grey;
+#if defined(DMG_NEON)
+        case DMG_KERNEL_NEON:
+            dmg_video_shade_neon(shade, color);
             break;
-        case DMG_COLOR_BLACK:
-            result = palette->black;
+#elif defined(DMG_SSE)
+        case DMG_KERNEL_SSSE3:
+            dmg_video_shade_ssse3(shade, color);
             break;
+#endif /* DMG_NEON */
         default:
+            dmg_video_shade_scalar(shade, color);
             break;
     }
-    return result;
 }
 
-static void dmg_video_render_background(dmg_t const dmg)
+static void dmg_video_render_span(dmg_t const dmg, uint8_t *color, uint8_t count, bool map, uint8_t x, uint8_t y)
 {
-    for (uint8_t pixel = 0; pixel < 160; ++pixel)
-    {
-        uint8_t color, map, x = pixel, y = dmg->video.line.y;
-        if (dmg->video.control.window_enabled && (dmg->video.window.x <= 166) && (dmg->video.window.y <= 143)
-                && ((dmg->video.window.x - 7) <= x) && (dmg->video.window.y <= y))
+    const uint8_t *tile = &dmg->video.ram[(map ? 0x1C00 : 0x1800) + (32 * ((y / 8) & 31))];
+    while (count)
+    { /* COPY ONE TILE ROW AT A TIME, WITH FINE SCROLL AT THE EDGES */
+        uint16_t id = tile[(x / 8) & 31];
+        uint8_t length = 8 - (x & 7);
+        if (!dmg->video.control.background_data)
         {
-            map = dmg->video.control.window_map;
-            x -= (dmg->video.window.x - 7);
-            y = dmg->video.window.counter - dmg->video.window.y;
+            id = 256 + (int8_t)id;
         }
-        else
+        if (length > count)
         {
-            map = dmg->video.control.background_map;
-            x += dmg->video.scroll.x;
-            y += dmg->video.scroll.y;
+            length = count;
         }
-        color = dmg_video_palette_color(&dmg->video.background.palette, dmg_video_background_color(dmg, map, x, y));
-        dmg->video.color[dmg->video.line.y][pixel] = color;
+        memcpy(color, &dmg->video.tile.row[0][id][y & 7][x & 7], length);
+        color += length;
+        count -= length;
+        x = (x & 0xF8) + 8;
+    }
+}
+
+static void dmg_video_render_background(dmg_t const dmg)
+{
+    uint8_t start = 160, *color = &dmg->video.line.color[8];
+    if (dmg->video.control.window_enabled && (dmg->video.window.x <= 166) && (dmg->video.window.y <= 143)
+            && (dmg->video.window.y <= dmg->video.line.y))
+    {
+        start = (dmg->video.window.x < 7) ? 0 : (dmg->video.window.x - 7);
+    }
+    if (start)
+    { /* BACKGROUND */
+        dmg_video_render_span(dmg, color, start, dmg->video.control.background_map, dmg->video.scroll.x, dmg->video.line.y + dmg->video.scroll.y);
     }
+    if (start < 160)
+    { /* WINDOW */
+        dmg_video_render_span(dmg, color + start, 160 - start, dmg->video.control.window_map, start - (dmg->video.window.x - 7),
+            dmg->video.window.counter - dmg->video.window.y);
+    }
+    dmg_video_shade(dmg, dmg->video.background.shade, color);
 }
 
 static void dmg_video_render_objects(dmg_t const dmg)
 {
-    uint8_t color, y = dmg->video.line.y;
+    uint8_t y = dmg->video.line.y;
     for (uint32_t index = 0; index < dmg->video.object.shown.count; ++index)
     {
-        const dmg_object_t *object = dmg->video.object.shown.entry[index].object;
-        for (uint8_t x = 0; x < 8; ++x)
-        {
-            if ((object->x < 8) && (x < (8 - object->x)))
-            {
-                continue;
-            }
-            else if ((object->x >= 160) && (x >= (8 - (object->x - 160))))
-            {
-                break;
-            }
-            if ((color = dmg_video_object_color(dmg, object, x, y)) != DMG_COLOR_WHITE)
-            {
-                if (!object->attribute.priority || (dmg->video.color[y][object->x + x - 8] == DMG_COLOR_WHITE))
-                {
-                    color = dmg_video_palette_color(&dmg->video.object.palette[object->attribute.palette], color);
-                    dmg->video.color[y][object->x + x - 8] = color;
-                }
-            }
+        const dmg_object_t *object = &dmg->video.object.ram[dmg->video.object.shown.index[index]];
+        if (object->x && (object->x < 168))
+        { /* LINE IS PADDED BY 8 PIXELS ON EACH SIDE */
+            dmg_video_merge(dmg, dmg->video.object.shade[object->attribute.palette], dmg_video_object_row(dmg, object, y),
+                &dmg->video.line.color[object->x], object->attribute.priority);
         }
     }
 }
 
 static void dmg_video_sort_objects(dmg_t const dmg)
 {
-    dmg->video.object.shown.count = 0;
-    uint8_t y = dmg->video.line.y, size = dmg->video.control.object_size ? 16 : 8;
-    for (uint8_t index = 0; index < 40; ++index)
-    {
-        const dmg_object_t *object = &dmg->video.object.ram[index];
-        if ((y >= (object->y - 16)) && (y < (object->y - 16 + size)))
-        {
-            dmg_object_entry_t *entry = &dmg->video.object.shown.entry[dmg->video.object.shown.count++];
-            entry->object = object;
-            entry->index = index;
-        }
-        if (dmg->video.object.shown.count >= 10)
-        {
-            break;
-        }
-    }
-    if (dmg->video.object.shown.count)
+    if (dmg->video.object.bucket.dirty || (dmg->video.object.bucket.size != dmg->video.control.object_size))
     {
-        qsort(dmg->video.object.shown.entry, dmg->video.object.shown.count, sizeof (*dmg->video.object.shown.entry),
-            dmg_video_object_comparator);
+        dmg_video_index_objects(dmg);
     }
+    dmg->video.object.shown = dmg->video.object.bucket.line[dmg->video.line.y];
 }
 
 static void dmg_video_coincidence(dmg_t const dmg)
@@ -196,6 +311,7 @@ static void dmg_video_dma(dmg_t const dmg)
         if (index < 0xA0)
         {
             ((uint8_t *)dmg->video.object.ram)[index] = dmg_system_read(dmg, dmg->video.dma.source++);
+            dmg->video.object.bucket.dirty = true;
             dmg->video.dma.delay = 4;
         }
         else
@@ -212,14 +328,24 @@ static void dmg_video_hblank(dmg_t const dmg)
 {
     if (dmg->video.control.enabled)
     {
+        bool objects = dmg->video.control.object_enabled && dmg->video.object.shown.count;
         if (dmg->video.control.background_enabled)
         {
             dmg_video_render_background(dmg);
         }
-        if (dmg->video.control.object_enabled && dmg->video.object.shown.count)
+        else if (objects)
+        { /* OBJECTS MERGE OVER THE PREVIOUS FRAME */
+            memcpy(&dmg->video.line.color[8], dmg->video.color[dmg->video.line.y], sizeof (*dmg->video.color));
+        }
+        if (objects)
         {
             dmg_video_render_objects(dmg);
         }
+        if ((dmg->video.control.background_enabled || objects) && memcmp(dmg->video.color[dmg->video.line.y], &dmg->video.line.color[8], sizeof (*dmg->video.color)))
+        {
+            memcpy(dmg->video.color[dmg->video.line.y], &dmg->video.line.color[8], sizeof (*dmg->video.color));
+            dmg_video_invalidate(dmg, dmg->video.line.y, dmg->video.line.y);
+        }
         if (dmg->video.status.hblank_interrupt)
         {
             dmg_processor_interrupt(dmg, DMG_INTERRUPT_LCDC);
@@ -265,9 +391,46 @@ static bool dmg_video_vblank(dmg_t const dmg)
     return result;
 }
 
-bool dmg_video_clock(dmg_t const dmg)
+static void dmg_video_schedule(dmg_t const dmg)
+{
+    uint32_t delay;
+    if (dmg->video.line.y < 144)
+    { /* SEARCH,TRANSFER,HBLANK,END */
+        delay = (dmg->video.line.x <= 80) ? (80 - dmg->video.line.x) : (dmg->video.line.x <= 260) ? (260 - dmg->video.line.x)
+            : (455 - dmg->video.line.x);
+    }
+    else
+    { /* VBLANK,END */
+        delay = 455 - dmg->video.line.x;
+    }
+    if (!dmg->video.line.x)
+    {
+        delay = 0;
+    }
+    if (dmg->video.dma.destination && (dmg->video.dma.delay < delay))
+    {
+        delay = dmg->video.dma.delay;
+    }
+    dmg_system_schedule(dmg, DMG_EVENT_VIDEO, dmg->video.cycle + delay);
+}
+
+static void dmg_video_update(dmg_t const dmg, uint64_t cycle)
+{
+    if (cycle > dmg->video.cycle)
+    { /* NO MODE CHANGES FALL BETWEEN EVENTS */
+        if (dmg->video.dma.destination)
+        {
+            dmg->video.dma.delay -= cycle - dmg->video.cycle;
+        }
+        dmg->video.line.x += cycle - dmg->video.cycle;
+        dmg->video.cycle = cycle;
+    }
+}
+
+static bool dmg_video_clock(dmg_t const dmg, uint64_t cycle)
 {
     bool result = false;
+    dmg_video_update(dmg, cycle);
     if (dmg->video.dma.destination)
     {
         dmg_video_dma(dmg);
@@ -308,12 +471,51 @@ bool dmg_video_clock(dmg_t const dmg)
         }
         dmg->video.line.x = 0;
     }
+    ++dmg->video.cycle;
+    dmg_video_schedule(dmg);
+    return result;
+}
+
+bool dmg_video_advance(dmg_t const dmg, uint32_t cycles)
+{
+    bool result = false;
+    uint64_t cycle, end = dmg_system_cycle(dmg) + cycles;
+    while ((cycle = dmg_system_timestamp(dmg, DMG_EVENT_VIDEO)) < end)
+    {
+        result |= dmg_video_clock(dmg, cycle);
+    }
+    return result;
+}
+
+const uint8_t *dmg_video_color(dmg_t const dmg, uint8_t y)
+{
+    return dmg->video.color[y];
+}
+
+bool dmg_video_dirty(dmg_t const dmg, uint8_t *first, uint8_t *last)
+{
+    bool result = (dmg->video.dirty.first <= dmg->video.dirty.last);
+    if (result)
+    {
+        *first = dmg->video.dirty.first;
+        *last = dmg->video.dirty.last;
+        dmg->video.dirty.first = 0xFF;
+        dmg->video.dirty.last = 0;
+    }
     return result;
 }
 
-dmg_color_e dmg_video_color(dmg_t const dmg, uint8_t x, uint8_t y)
+void dmg_video_initialize(dmg_t const dmg)
 {
-    return dmg->video.color[y][x];
+    dmg->video.dirty.first = 0;
+    dmg->video.dirty.last = 143;
+#if defined(DMG_NEON)
+    dmg->video.kernel = DMG_KERNEL_NEON;
+#elif defined(DMG_SSE)
+    dmg->video.kernel = __builtin_cpu_supports("ssse3") ? DMG_KERNEL_SSSE3 : DMG_KERNEL_SCALAR;
+#else
+    dmg->video.kernel = DMG_KERNEL_SCALAR;
+#endif /* DMG_NEON */
 }
 
 uint8_t dmg_video_read(dmg_t const dmg, uint16_t address)
@@ -380,28 +582,32 @@ void dmg_video_write(dmg_t const dmg, uint16_t address, uint8_t value)
             if (!dmg->video.control.enabled || (dmg->video.status.mode < 3))
             { /* HBLANK,VBLANK,SEARCH */
                 dmg->video.ram[address - 0x8000] = value;
+                if (address < 0x9800)
+                { /* TILE DATA */
+                    dmg_video_decode(dmg, address - 0x8000);
+                }
             }
             break;
         case 0xFE00 ... 0xFE9F: /* OBJECT RAM */
             if (!dmg->video.control.enabled || (dmg->video.status.mode < 2))
             { /* HBLANK,VBLANK */
                 ((uint8_t *)dmg->video.object.ram)[address - 0xFE00] = value;
+                dmg->video.object.bucket.dirty = true;
             }
             break;
         case 0xFF40: /* LCDC */
+            dmg_video_update(dmg, dmg_system_cycle(dmg));
+            dmg_system_schedule(dmg, DMG_EVENT_VIDEO, dmg_system_cycle(dmg));
             dmg->video.control.raw = value;
             if (!dmg->video.control.enabled)
             {
-                for (uint8_t y = 0; y < 144; ++y)
-                {
-                    for (uint8_t x = 0; x < 160; ++x)
-                    {
-                        dmg->video.color[y][x] = DMG_COLOR_WHITE;
-                    }
-                }
+                memset(dmg->video.color, DMG_COLOR_WHITE, sizeof (dmg->video.color));
+                dmg_video_invalidate(dmg, 0, 143);
             }
             break;
         case 0xFF41: /* STAT */
+            dmg_video_update(dmg, dmg_system_cycle(dmg));
+            dmg_system_schedule(dmg, DMG_EVENT_VIDEO, dmg_system_cycle(dmg));
             dmg->video.status.raw = value;
             break;
         case 0xFF42: /* SCY */
@@ -411,21 +617,25 @@ void dmg_video_write(dmg_t const dmg, uint16_t address, uint8_t value)
             dmg->video.scroll.x = value;
             break;
         case 0xFF45: /* LYC */
+            dmg_video_update(dmg, dmg_system_cycle(dmg));
+            dmg_system_schedule(dmg, DMG_EVENT_VIDEO, dmg_system_cycle(dmg));
             dmg->video.line.coincidence = value;
             break;
         case 0xFF46: /* DMA */
+            dmg_video_update(dmg, dmg_system_cycle(dmg));
+            dmg_system_schedule(dmg, DMG_EVENT_VIDEO, dmg_system_cycle(dmg));
             dmg->video.dma.delay = 4;
             dmg->video.dma.destination = 0xFE00;
             dmg->video.dma.source = value << 8;
             break;
         case 0xFF47: /* BGP */
-            dmg->video.background.palette.raw = value;
+            dmg_video_palette(&dmg->video.background.palette, dmg->video.background.shade, value);
             break;
         case 0xFF48: /* OBP0 */
-            dmg->video.object.palette[0].raw = value;
+            dmg_video_palette(&dmg->video.object.palette[0], dmg->video.object.shade[0], value);
             break;
         case 0xFF49: /* OBP1 */
-            dmg->video.object.palette[1].raw = value;
+            dmg_video_palette(&dmg->video.object.palette[1], dmg->video.object.shade[1], value);
             break;
         case 0xFF4A: /* WY */
             dmg->video.window.y = value;
@@ -17,6 +17,13 @@ typedef enum
     DMG_COLOR_MAX,
 } dmg_color_e;
 
+typedef enum
+{
+    DMG_KERNEL_SCALAR = 0,
+    DMG_KERNEL_NEON,
+    DMG_KERNEL_SSSE3,
+} dmg_kernel_e;
+
 typedef struct
 {
     uint8_t y;
@@ -38,9 +45,9 @@ typedef struct
 
 typedef struct
 {
-    uint8_t index;
-    const dmg_object_t *object;
-} dmg_object_entry_t;
+    uint8_t count;
+    uint8_t index[10];
+} dmg_object_bucket_t;
 
 typedef union
 {
@@ -56,11 +63,13 @@ typedef union
 
 typedef struct
 {
-    dmg_color_e color[144][160];
+    uint64_t cycle;
+    uint8_t color[144][160];
     uint8_t ram[0x2000];
     struct
     {
         dmg_palette_t palette;
+        uint8_t shade[4];
     } background;
     union
     {
@@ -78,14 +87,21 @@ typedef struct
         uint8_t raw;
     } control;
     struct
+    {
+        uint8_t first;
+        uint8_t last;
+    } dirty;
+    struct
     {
         uint8_t delay;
         uint16_t destination;
         uint16_t source;
     } dma;
+    dmg_kernel_e kernel;
     struct
     {
         uint8_t coincidence;
+        uint8_t color[176];
         uint16_t x;
         uint8_t y;
     } line;
@@ -93,11 +109,14 @@ typedef struct
     {
         dmg_palette_t palette[2];
         dmg_object_t ram[40];
+        uint8_t shade[2][4];
+        dmg_object_bucket_t shown;
         struct
         {
-            uint8_t count;
-            dmg_object_entry_t entry[10];
-        } shown;
+            bool dirty;
+            uint8_t size;
+            dmg_object_bucket_t line[144];
+        } bucket;
     } object;
     struct
     {
@@ -118,6 +137,10 @@ typedef struct
         uint8_t raw;
     } status;
     struct
+    {
+        uint8_t row[2][384][8][8];
+    } tile;
+    struct
     {
         uint8_t counter;
         uint8_t x;
@@ -125,8 +148,10 @@ typedef struct
     } window;
 } dmg_video_t;
 
-bool dmg_video_clock(dmg_t const dmg);
-dmg_color_e dmg_video_color(dmg_t const dmg, uint8_t x, uint8_t y);
+bool dmg_video_advance(dmg_t const dmg, uint32_t cycles);
+const uint8_t *dmg_video_color(dmg_t const dmg, uint8_t y);
+bool dmg_video_dirty(dmg_t const dmg, uint8_t *first, uint8_t *last);
+void dmg_video_initialize(dmg_t const dmg);
 uint8_t dmg_video_read(dmg_t const dmg, uint16_t address);
 void dmg_video_write(dmg_t const dmg, uint16_t address, uint8_t value);
 
@@ -8,6 +8,7 @@
 static const struct option COMMAND[] =
 {
     { "help", no_argument, NULL, 'h', },
+    { "jit", no_argument, NULL, 'j', },
     { "link", no_argument, NULL, 'l', },
     { "version", no_argument, NULL, 'v', },
     { NULL, 0, NULL, 0, },
@@ -16,10 +17,22 @@ static const struct option COMMAND[] =
 static const char *DESCRIPTION[] =
 {
     "Show help information",
+    "Enable dynamic recompiler",
     "Enable serial link",
     "Show version information",
 };
 
+static int argument_jit(argument_t *const argument)
+{
+    if (argument->jit)
+    {
+        fprintf(stderr, "Redefined dynamic recompiler\n");
+        return EXIT_FAILURE;
+    }
+    argument->jit = true;
+    return EXIT_SUCCESS;
+}
+
 static int argument_link(argument_t *const argument)
 {
     if (argument->link)
@@ -59,13 +72,19 @@ int argument_parse(int argc, char *argv[], argument_t *const argument)
 {
     int option, index, result;
     opterr = 1;
-    while ((option = getopt_long(argc, argv, "hlv", COMMAND, &index)) != -1)
+    while ((option = getopt_long(argc, argv, "hjlv", COMMAND, &index)) != -1)
     {
         switch (option)
         {
             case 'h': /* HELP */
                 argument_usage();
                 return EXIT_FAILURE;
+            case 'j': /* JIT */
+                if ((result = argument_jit(argument)) != EXIT_SUCCESS)
+                {
+                    return result;
+                }
+                break;
             case 'l': /* LINK */
                 if ((result = argument_link(argument)) != EXIT_SUCCESS)
                 {
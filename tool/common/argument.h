@@ -10,6 +10,7 @@
 
 typedef struct
 {
+    bool jit;
     bool link;
     char *path;
 } argument_t;
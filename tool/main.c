@@ -54,6 +54,11 @@ static int initialize(int argc, char *argv[])
         fprintf(stderr, "%s\n", dmg_error(g_context.dmg));
         return EXIT_FAILURE;
     }
+    if (g_context.argument.jit && (dmg_jit(g_context.dmg) != DMG_SUCCESS))
+    {
+        fprintf(stderr, "%s\n", dmg_error(g_context.dmg));
+        return EXIT_FAILURE;
+    }
     return result;
 }
 